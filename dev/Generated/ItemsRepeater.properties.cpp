@@ -11,6 +11,7 @@ CppWinRTActivatableClassWithDPFactory(ItemsRepeater)
 GlobalDependencyProperty ItemsRepeaterProperties::s_AnimatorProperty{ nullptr };
 GlobalDependencyProperty ItemsRepeaterProperties::s_BackgroundProperty{ nullptr };
 GlobalDependencyProperty ItemsRepeaterProperties::s_HorizontalCacheLengthProperty{ nullptr };
+GlobalDependencyProperty ItemsRepeaterProperties::s_IsCollectionChangeCoalescingEnabledProperty{ nullptr };
 GlobalDependencyProperty ItemsRepeaterProperties::s_ItemsSourceProperty{ nullptr };
 GlobalDependencyProperty ItemsRepeaterProperties::s_ItemTemplateProperty{ nullptr };
 GlobalDependencyProperty ItemsRepeaterProperties::s_LayoutProperty{ nullptr };
@@ -59,6 +60,17 @@ void ItemsRepeaterProperties::EnsureProperties()
                 ValueHelper<double>::BoxValueIfNecessary(2.0),
                 winrt::PropertyChangedCallback(&OnHorizontalCacheLengthPropertyChanged));
     }
+    if (!s_IsCollectionChangeCoalescingEnabledProperty)
+    {
+        s_IsCollectionChangeCoalescingEnabledProperty =
+            InitializeDependencyProperty(
+                L"IsCollectionChangeCoalescingEnabled",
+                winrt::name_of<bool>(),
+                winrt::name_of<winrt::ItemsRepeater>(),
+                false /* isAttached */,
+                ValueHelper<bool>::BoxValueIfNecessary(false),
+                winrt::PropertyChangedCallback(&OnIsCollectionChangeCoalescingEnabledPropertyChanged));
+    }
     if (!s_ItemsSourceProperty)
     {
         s_ItemsSourceProperty =
@@ -110,6 +122,7 @@ void ItemsRepeaterProperties::ClearProperties()
     s_AnimatorProperty = nullptr;
     s_BackgroundProperty = nullptr;
     s_HorizontalCacheLengthProperty = nullptr;
+    s_IsCollectionChangeCoalescingEnabledProperty = nullptr;
     s_ItemsSourceProperty = nullptr;
     s_ItemTemplateProperty = nullptr;
     s_LayoutProperty = nullptr;
@@ -132,6 +145,14 @@ void ItemsRepeaterProperties::OnHorizontalCacheLengthPropertyChanged(
     winrt::get_self<ItemsRepeater>(owner)->OnPropertyChanged(args);
 }
 
+void ItemsRepeaterProperties::OnIsCollectionChangeCoalescingEnabledPropertyChanged(
+    winrt::DependencyObject const& sender,
+    winrt::DependencyPropertyChangedEventArgs const& args)
+{
+    auto owner = sender.as<winrt::ItemsRepeater>();
+    winrt::get_self<ItemsRepeater>(owner)->OnPropertyChanged(args);
+}
+
 void ItemsRepeaterProperties::OnItemsSourcePropertyChanged(
     winrt::DependencyObject const& sender,
     winrt::DependencyPropertyChangedEventArgs const& args)
@@ -194,6 +215,16 @@ double ItemsRepeaterProperties::HorizontalCacheLength()
     return ValueHelper<double>::CastOrUnbox(static_cast<ItemsRepeater*>(this)->GetValue(s_HorizontalCacheLengthProperty));
 }
 
+void ItemsRepeaterProperties::IsCollectionChangeCoalescingEnabled(bool value)
+{
+    static_cast<ItemsRepeater*>(this)->SetValue(s_IsCollectionChangeCoalescingEnabledProperty, ValueHelper<bool>::BoxValueIfNecessary(value));
+}
+
+bool ItemsRepeaterProperties::IsCollectionChangeCoalescingEnabled()
+{
+    return ValueHelper<bool>::CastOrUnbox(static_cast<ItemsRepeater*>(this)->GetValue(s_IsCollectionChangeCoalescingEnabledProperty));
+}
+
 void ItemsRepeaterProperties::ItemsSource(winrt::IInspectable const& value)
 {
     static_cast<ItemsRepeater*>(this)->SetValue(s_ItemsSourceProperty, ValueHelper<winrt::IInspectable>::BoxValueIfNecessary(value));
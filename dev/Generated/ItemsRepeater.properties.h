@@ -18,6 +18,9 @@ public:
     void HorizontalCacheLength(double value);
     double HorizontalCacheLength();
 
+    void IsCollectionChangeCoalescingEnabled(bool value);
+    bool IsCollectionChangeCoalescingEnabled();
+
     void ItemsSource(winrt::IInspectable const& value);
     winrt::IInspectable ItemsSource();
 
@@ -33,6 +36,7 @@ public:
     static winrt::DependencyProperty AnimatorProperty() { return s_AnimatorProperty; }
     static winrt::DependencyProperty BackgroundProperty() { return s_BackgroundProperty; }
     static winrt::DependencyProperty HorizontalCacheLengthProperty() { return s_HorizontalCacheLengthProperty; }
+    static winrt::DependencyProperty IsCollectionChangeCoalescingEnabledProperty() { return s_IsCollectionChangeCoalescingEnabledProperty; }
     static winrt::DependencyProperty ItemsSourceProperty() { return s_ItemsSourceProperty; }
     static winrt::DependencyProperty ItemTemplateProperty() { return s_ItemTemplateProperty; }
     static winrt::DependencyProperty LayoutProperty() { return s_LayoutProperty; }
@@ -41,6 +45,7 @@ public:
     static GlobalDependencyProperty s_AnimatorProperty;
     static GlobalDependencyProperty s_BackgroundProperty;
     static GlobalDependencyProperty s_HorizontalCacheLengthProperty;
+    static GlobalDependencyProperty s_IsCollectionChangeCoalescingEnabledProperty;
     static GlobalDependencyProperty s_ItemsSourceProperty;
     static GlobalDependencyProperty s_ItemTemplateProperty;
     static GlobalDependencyProperty s_LayoutProperty;
@@ -68,6 +73,10 @@ public:
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
 
+    static void OnIsCollectionChangeCoalescingEnabledPropertyChanged(
+        winrt::DependencyObject const& sender,
+        winrt::DependencyPropertyChangedEventArgs const& args);
+
     static void OnItemsSourcePropertyChanged(
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
@@ -16,6 +16,7 @@ GlobalDependencyProperty ScrollerProperties::s_HorizontalScrollChainingModePrope
 GlobalDependencyProperty ScrollerProperties::s_HorizontalScrollModeProperty{ nullptr };
 GlobalDependencyProperty ScrollerProperties::s_HorizontalScrollRailingModeProperty{ nullptr };
 GlobalDependencyProperty ScrollerProperties::s_IgnoredInputKindProperty{ nullptr };
+GlobalDependencyProperty ScrollerProperties::s_IsViewChangeCoalescingEnabledProperty{ nullptr };
 GlobalDependencyProperty ScrollerProperties::s_MaxZoomFactorProperty{ nullptr };
 GlobalDependencyProperty ScrollerProperties::s_MinZoomFactorProperty{ nullptr };
 GlobalDependencyProperty ScrollerProperties::s_VerticalAnchorRatioProperty{ nullptr };
@@ -129,6 +130,17 @@ void ScrollerProperties::EnsureProperties()
                 ValueHelper<winrt::InputKind>::BoxValueIfNecessary(Scroller::s_defaultIgnoredInputKind),
                 winrt::PropertyChangedCallback(&OnIgnoredInputKindPropertyChanged));
     }
+    if (!s_IsViewChangeCoalescingEnabledProperty)
+    {
+        s_IsViewChangeCoalescingEnabledProperty =
+            InitializeDependencyProperty(
+                L"IsViewChangeCoalescingEnabled",
+                winrt::name_of<bool>(),
+                winrt::name_of<winrt::Scroller>(),
+                false /* isAttached */,
+                ValueHelper<bool>::BoxValueIfNecessary(Scroller::s_defaultIsViewChangeCoalescingEnabled),
+                winrt::PropertyChangedCallback(&OnIsViewChangeCoalescingEnabledPropertyChanged));
+    }
     if (!s_MaxZoomFactorProperty)
     {
         s_MaxZoomFactorProperty =
@@ -229,6 +241,7 @@ void ScrollerProperties::ClearProperties()
     s_HorizontalScrollModeProperty = nullptr;
     s_HorizontalScrollRailingModeProperty = nullptr;
     s_IgnoredInputKindProperty = nullptr;
+    s_IsViewChangeCoalescingEnabledProperty = nullptr;
     s_MaxZoomFactorProperty = nullptr;
     s_MinZoomFactorProperty = nullptr;
     s_VerticalAnchorRatioProperty = nullptr;
@@ -313,6 +326,14 @@ void ScrollerProperties::OnIgnoredInputKindPropertyChanged(
     winrt::get_self<Scroller>(owner)->OnPropertyChanged(args);
 }
 
+void ScrollerProperties::OnIsViewChangeCoalescingEnabledPropertyChanged(
+    winrt::DependencyObject const& sender,
+    winrt::DependencyPropertyChangedEventArgs const& args)
+{
+    auto owner = sender.as<winrt::Scroller>();
+    winrt::get_self<Scroller>(owner)->OnPropertyChanged(args);
+}
+
 void ScrollerProperties::OnMaxZoomFactorPropertyChanged(
     winrt::DependencyObject const& sender,
     winrt::DependencyPropertyChangedEventArgs const& args)
@@ -488,6 +509,16 @@ winrt::InputKind ScrollerProperties::IgnoredInputKind()
     return ValueHelper<winrt::InputKind>::CastOrUnbox(static_cast<Scroller*>(this)->GetValue(s_IgnoredInputKindProperty));
 }
 
+void ScrollerProperties::IsViewChangeCoalescingEnabled(bool value)
+{
+    static_cast<Scroller*>(this)->SetValue(s_IsViewChangeCoalescingEnabledProperty, ValueHelper<bool>::BoxValueIfNecessary(value));
+}
+
+bool ScrollerProperties::IsViewChangeCoalescingEnabled()
+{
+    return ValueHelper<bool>::CastOrUnbox(static_cast<Scroller*>(this)->GetValue(s_IsViewChangeCoalescingEnabledProperty));
+}
+
 void ScrollerProperties::MaxZoomFactor(double value)
 {
     static_cast<Scroller*>(this)->ValidateZoomFactoryBoundary(value);
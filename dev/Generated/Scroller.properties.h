@@ -33,6 +33,9 @@ public:
     void IgnoredInputKind(winrt::InputKind const& value);
     winrt::InputKind IgnoredInputKind();
 
+    void IsViewChangeCoalescingEnabled(bool value);
+    bool IsViewChangeCoalescingEnabled();
+
     void MaxZoomFactor(double value);
     double MaxZoomFactor();
 
@@ -65,6 +68,7 @@ public:
     static winrt::DependencyProperty HorizontalScrollModeProperty() { return s_HorizontalScrollModeProperty; }
     static winrt::DependencyProperty HorizontalScrollRailingModeProperty() { return s_HorizontalScrollRailingModeProperty; }
     static winrt::DependencyProperty IgnoredInputKindProperty() { return s_IgnoredInputKindProperty; }
+    static winrt::DependencyProperty IsViewChangeCoalescingEnabledProperty() { return s_IsViewChangeCoalescingEnabledProperty; }
     static winrt::DependencyProperty MaxZoomFactorProperty() { return s_MaxZoomFactorProperty; }
     static winrt::DependencyProperty MinZoomFactorProperty() { return s_MinZoomFactorProperty; }
     static winrt::DependencyProperty VerticalAnchorRatioProperty() { return s_VerticalAnchorRatioProperty; }
@@ -82,6 +86,7 @@ public:
     static GlobalDependencyProperty s_HorizontalScrollModeProperty;
     static GlobalDependencyProperty s_HorizontalScrollRailingModeProperty;
     static GlobalDependencyProperty s_IgnoredInputKindProperty;
+    static GlobalDependencyProperty s_IsViewChangeCoalescingEnabledProperty;
     static GlobalDependencyProperty s_MaxZoomFactorProperty;
     static GlobalDependencyProperty s_MinZoomFactorProperty;
     static GlobalDependencyProperty s_VerticalAnchorRatioProperty;
@@ -155,6 +160,10 @@ public:
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
 
+    static void OnIsViewChangeCoalescingEnabledPropertyChanged(
+        winrt::DependencyObject const& sender,
+        winrt::DependencyPropertyChangedEventArgs const& args);
+
     static void OnMaxZoomFactorPropertyChanged(
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
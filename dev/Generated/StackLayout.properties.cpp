@@ -8,6 +8,7 @@
 
 CppWinRTActivatableClassWithDPFactory(StackLayout)
 
+GlobalDependencyProperty StackLayoutProperties::s_IsItemSizeIndexEnabledProperty{ nullptr };
 GlobalDependencyProperty StackLayoutProperties::s_OrientationProperty{ nullptr };
 GlobalDependencyProperty StackLayoutProperties::s_SpacingProperty{ nullptr };
 
@@ -18,6 +19,17 @@ StackLayoutProperties::StackLayoutProperties()
 
 void StackLayoutProperties::EnsureProperties()
 {
+    if (!s_IsItemSizeIndexEnabledProperty)
+    {
+        s_IsItemSizeIndexEnabledProperty =
+            InitializeDependencyProperty(
+                L"IsItemSizeIndexEnabled",
+                winrt::name_of<bool>(),
+                winrt::name_of<winrt::StackLayout>(),
+                false /* isAttached */,
+                ValueHelper<bool>::BoxValueIfNecessary(false),
+                winrt::PropertyChangedCallback(&OnIsItemSizeIndexEnabledPropertyChanged));
+    }
     if (!s_OrientationProperty)
     {
         s_OrientationProperty =
@@ -44,10 +56,19 @@ void StackLayoutProperties::EnsureProperties()
 
 void StackLayoutProperties::ClearProperties()
 {
+    s_IsItemSizeIndexEnabledProperty = nullptr;
     s_OrientationProperty = nullptr;
     s_SpacingProperty = nullptr;
 }
 
+void StackLayoutProperties::OnIsItemSizeIndexEnabledPropertyChanged(
+    winrt::DependencyObject const& sender,
+    winrt::DependencyPropertyChangedEventArgs const& args)
+{
+    auto owner = sender.as<winrt::StackLayout>();
+    winrt::get_self<StackLayout>(owner)->OnPropertyChanged(args);
+}
+
 void StackLayoutProperties::OnOrientationPropertyChanged(
     winrt::DependencyObject const& sender,
     winrt::DependencyPropertyChangedEventArgs const& args)
@@ -64,6 +85,16 @@ void StackLayoutProperties::OnSpacingPropertyChanged(
     winrt::get_self<StackLayout>(owner)->OnPropertyChanged(args);
 }
 
+void StackLayoutProperties::IsItemSizeIndexEnabled(bool value)
+{
+    static_cast<StackLayout*>(this)->SetValue(s_IsItemSizeIndexEnabledProperty, ValueHelper<bool>::BoxValueIfNecessary(value));
+}
+
+bool StackLayoutProperties::IsItemSizeIndexEnabled()
+{
+    return ValueHelper<bool>::CastOrUnbox(static_cast<StackLayout*>(this)->GetValue(s_IsItemSizeIndexEnabledProperty));
+}
+
 void StackLayoutProperties::Orientation(winrt::Orientation const& value)
 {
     static_cast<StackLayout*>(this)->SetValue(s_OrientationProperty, ValueHelper<winrt::Orientation>::BoxValueIfNecessary(value));
@@ -9,21 +9,30 @@ class StackLayoutProperties
 public:
     StackLayoutProperties();
 
+    void IsItemSizeIndexEnabled(bool value);
+    bool IsItemSizeIndexEnabled();
+
     void Orientation(winrt::Orientation const& value);
     winrt::Orientation Orientation();
 
     void Spacing(double value);
     double Spacing();
 
+    static winrt::DependencyProperty IsItemSizeIndexEnabledProperty() { return s_IsItemSizeIndexEnabledProperty; }
     static winrt::DependencyProperty OrientationProperty() { return s_OrientationProperty; }
     static winrt::DependencyProperty SpacingProperty() { return s_SpacingProperty; }
 
+    static GlobalDependencyProperty s_IsItemSizeIndexEnabledProperty;
     static GlobalDependencyProperty s_OrientationProperty;
     static GlobalDependencyProperty s_SpacingProperty;
 
     static void EnsureProperties();
     static void ClearProperties();
 
+    static void OnIsItemSizeIndexEnabledPropertyChanged(
+        winrt::DependencyObject const& sender,
+        winrt::DependencyPropertyChangedEventArgs const& args);
+
     static void OnOrientationPropertyChanged(
         winrt::DependencyObject const& sender,
         winrt::DependencyPropertyChangedEventArgs const& args);
@@ -10,6 +10,7 @@ using System;
 using Windows.UI.Xaml.Media;
 using Windows.UI;
 using Windows.Foundation;
+using System.Diagnostics;
 using Common;
 
 #if USING_TAEF
@@ -238,6 +239,111 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
 
             IdleSynchronizer.Wait();
         }
+
+        [TestMethod]
+        public void VerifyComputeChildBoundsWithLargeChildCount()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                const int childCount = 50000;
+                var uiThreadPanel = new LayoutPanel() { Width = 400, Layout = new MyCustomNonVirtualizingGridLayout() { UseComputeChildBounds = false } };
+                var geometryPanel = new LayoutPanel() { Width = 400, Layout = new MyCustomNonVirtualizingGridLayout() { UseComputeChildBounds = true } };
+                foreach (var panel in new[] { uiThreadPanel, geometryPanel })
+                {
+                    for (int i = 0; i < childCount; i++)
+                    {
+                        panel.Children.Add(new Border() { Width = 50, Height = 20 });
+                    }
+                }
+
+                var stackPanel = new StackPanel();
+                stackPanel.Children.Add(uiThreadPanel);
+                stackPanel.Children.Add(geometryPanel);
+                Content = new ScrollViewer() { Content = stackPanel };
+                Content.UpdateLayout();
+
+                foreach (var panel in new[] { uiThreadPanel, geometryPanel })
+                {
+                    var layout = (MyCustomNonVirtualizingGridLayout)panel.Layout;
+                    Log.Comment(string.Format("UseComputeChildBounds={0}: Measure {1:0.00}ms, Arrange {2:0.00}ms",
+                        layout.UseComputeChildBounds,
+                        layout.LastMeasureTime.TotalMilliseconds,
+                        layout.LastArrangeTime.TotalMilliseconds));
+                }
+
+                Verify.AreEqual(uiThreadPanel.DesiredSize, geometryPanel.DesiredSize);
+                foreach (int index in new[] { 0, 7, 8, 4095, 4096, 25000, childCount - 1 })
+                {
+                    Verify.AreEqual(
+                        LayoutInformation.GetLayoutSlot((FrameworkElement)uiThreadPanel.Children[index]),
+                        LayoutInformation.GetLayoutSlot((FrameworkElement)geometryPanel.Children[index]),
+                        "Verify LayoutSlot of child " + index);
+                }
+            });
+        }
+    }
+
+    public class MyCustomNonVirtualizingGridLayout : NonVirtualizingLayout
+    {
+        public bool UseComputeChildBounds { get; set; }
+        public TimeSpan LastMeasureTime { get; private set; }
+        public TimeSpan LastArrangeTime { get; private set; }
+
+        private const double CellWidth = 50;
+        private const double CellHeight = 20;
+        private Rect[] _bounds;
+
+        protected override Size MeasureOverride(NonVirtualizingLayoutContext context, Size availableSize)
+        {
+            var children = context.Children;
+            foreach (var element in children)
+            {
+                element.Measure(new Size(CellWidth, CellHeight));
+            }
+
+            int columns = Math.Max(1, (int)(availableSize.Width / CellWidth));
+            var stopwatch = Stopwatch.StartNew();
+            if (UseComputeChildBounds)
+            {
+                _bounds = context.ComputeChildBounds((startIndex, desiredSizes, bounds) =>
+                {
+                    for (int i = 0; i < desiredSizes.Length; i++)
+                    {
+                        bounds[i] = GetBounds(startIndex + i, columns, desiredSizes[i]);
+                    }
+                });
+            }
+            else
+            {
+                _bounds = new Rect[children.Count];
+                for (int i = 0; i < _bounds.Length; i++)
+                {
+                    _bounds[i] = GetBounds(i, columns, children[i].DesiredSize);
+                }
+            }
+            LastMeasureTime = stopwatch.Elapsed;
+
+            int rows = (_bounds.Length + columns - 1) / columns;
+            return new Size(columns * CellWidth, rows * CellHeight);
+        }
+
+        protected override Size ArrangeOverride(NonVirtualizingLayoutContext context, Size finalSize)
+        {
+            var stopwatch = Stopwatch.StartNew();
+            var children = context.Children;
+            for (int i = 0; i < _bounds.Length; i++)
+            {
+                children[i].Arrange(_bounds[i]);
+            }
+            LastArrangeTime = stopwatch.Elapsed;
+
+            return finalSize;
+        }
+
+        private static Rect GetBounds(int index, int columns, Size desiredSize)
+        {
+            return new Rect((index % columns) * CellWidth, (index / columns) * CellHeight, desiredSize.Width, desiredSize.Height);
+        }
     }
 
     public class MyCustomNonVirtualizingStackLayout: NonVirtualizingLayout
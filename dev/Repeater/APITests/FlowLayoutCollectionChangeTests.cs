@@ -4,6 +4,7 @@
 using Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests.Common;
 using MUXControlsTestApp.Utilities;
 using System;
+using System.Collections.Generic;
 using System.Linq;
 using Windows.UI.Xaml;
 using Windows.UI.Xaml.Controls;
@@ -107,6 +108,91 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateCoalescedCollectionChanges()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var dataSource = new CustomItemsSource(Enumerable.Range(0, 10).ToList());
+                var repeater = SetupRepeater(dataSource);
+                repeater.IsCollectionChangeCoalescingEnabled = true;
+
+                Log.Comment("Inserting 50 items one at a time at index 2");
+                for (int i = 0; i < 50; i++)
+                {
+                    dataSource.Insert(index: 2 + i, count: 1, reset: false, valueStart: 1000 + i);
+                }
+
+                Log.Comment("Removing 20 of the inserted items one at a time");
+                for (int i = 0; i < 20; i++)
+                {
+                    dataSource.Remove(index: 10, count: 1, reset: false);
+                }
+
+                Log.Comment("Replacing 5 items one at a time");
+                for (int i = 0; i < 5; i++)
+                {
+                    dataSource.Replace(index: 3 + i, oldCount: 1, newCount: 1, reset: false);
+                }
+
+                repeater.UpdateLayout();
+
+                var realized = VerifyRealizedRange(repeater, dataSource);
+                Verify.IsGreaterThan(realized, 0);
+
+                Log.Comment("Changes are applied before the mapping APIs are used");
+                dataSource.Remove(index: 0, count: 1, reset: false);
+                var element = repeater.TryGetElement(0);
+                Verify.IsNotNull(element);
+                Verify.AreEqual(0, repeater.GetElementIndex(element));
+
+                Log.Comment("Turning coalescing off applies the pending changes");
+                dataSource.Insert(index: 0, count: 3, reset: false);
+                repeater.IsCollectionChangeCoalescingEnabled = false;
+                repeater.UpdateLayout();
+
+                realized = VerifyRealizedRange(repeater, dataSource);
+                Verify.IsGreaterThan(realized, 0);
+            });
+        }
+
+        [TestMethod]
+        public void ValidateElementIndexChangedWithCoalescedCollectionChanges()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var dataSource = new CustomItemsSource(Enumerable.Range(0, 10).ToList());
+                var repeater = SetupRepeater(dataSource);
+                repeater.IsCollectionChangeCoalescingEnabled = true;
+                var element1 = repeater.TryGetElement(1);
+                Verify.IsNotNull(element1);
+
+                var raisedIndices = new List<Tuple<int, int>>();
+                repeater.ElementIndexChanged += (sender, args) =>
+                {
+                    if (args.Element == element1)
+                    {
+                        raisedIndices.Add(Tuple.Create(args.OldIndex, args.NewIndex));
+                    }
+
+                    // The source already holds the final items, so the new index has to be final too.
+                    Verify.AreEqual(((FrameworkElement)args.Element).DataContext, repeater.ItemsSourceView.GetAt(args.NewIndex));
+                };
+
+                Log.Comment("Insert two items in front, then remove the item that was at index 0");
+                dataSource.Insert(index: 0, count: 2, reset: false);
+                dataSource.Remove(index: 2, count: 1, reset: false);
+                Verify.AreEqual(0, raisedIndices.Count);
+
+                Log.Comment("Elements are told where they ended up, once");
+                repeater.UpdateLayout();
+                Verify.AreEqual(1, raisedIndices.Count);
+                Verify.AreEqual(1, raisedIndices[0].Item1);
+                Verify.AreEqual(2, raisedIndices[0].Item2);
+                Verify.AreEqual(2, repeater.GetElementIndex(element1));
+            });
+        }
+
         [TestMethod]
         public void CanRemoveItemsStartingBeforeRealizedRange()
         {
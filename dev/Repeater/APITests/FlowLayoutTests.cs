@@ -1241,6 +1241,173 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateStackLayoutExtentWithItemSizeIndex()
+        {
+            // The first half of the items is much smaller than the second half. Once every item
+            // has been measured, the extent should be exact instead of being extrapolated from
+            // the items that were measured last.
+            ItemsRepeater repeater = null;
+            ScrollViewer scrollViewer = null;
+            ManualResetEvent viewChanged = new ManualResetEvent(false);
+            RunOnUIThread.Execute(() =>
+            {
+                repeater = new ItemsRepeater()
+                {
+                    ItemsSource = Enumerable.Range(0, 200).Select(i => i < 100 ? 10 : 90).ToList(),
+                    ItemTemplate = GetDataTemplate(@"<Border Width='100' Height='{Binding}'/>"),
+                    Layout = new StackLayout() { IsItemSizeIndexEnabled = true },
+                    HorizontalCacheLength = 0,
+                    VerticalCacheLength = 0,
+                };
+
+                scrollViewer = new ScrollViewer()
+                {
+                    Content = repeater,
+                    Height = 200,
+                };
+
+                scrollViewer.ViewChanged += (sender, args) =>
+                {
+                    if (!args.IsIntermediate)
+                    {
+                        viewChanged.Set();
+                    }
+                };
+
+                Content = new ItemsRepeaterScrollHost() { ScrollViewer = scrollViewer };
+                Content.UpdateLayout();
+            });
+
+            // Scroll one viewport at a time so that every item gets measured.
+            bool reachedEnd = false;
+            double offset = 0;
+            while (!reachedEnd)
+            {
+                offset += 200;
+                viewChanged.Reset();
+                RunOnUIThread.Execute(() =>
+                {
+                    reachedEnd = offset >= scrollViewer.ScrollableHeight;
+                    scrollViewer.ChangeView(horizontalOffset: null, verticalOffset: offset, zoomFactor: null, disableAnimation: true);
+                });
+
+                IdleSynchronizer.Wait();
+                Verify.IsTrue(viewChanged.WaitOne(DefaultWaitTime));
+            }
+
+            viewChanged.Reset();
+            RunOnUIThread.Execute(() =>
+            {
+                scrollViewer.ChangeView(horizontalOffset: null, verticalOffset: 0, zoomFactor: null, disableAnimation: true);
+            });
+
+            IdleSynchronizer.Wait();
+            Verify.IsTrue(viewChanged.WaitOne(DefaultWaitTime));
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.AreEqual(100 * 10 + 100 * 90, repeater.DesiredSize.Height);
+            });
+        }
+
+        [TestMethod]
+        public void ValidateUniformGridLayoutClosedFormAndFallbackAgree()
+        {
+            // The first layout realizes items in closed form. Bringing a far away item into view
+            // goes through the regular generate path, which places the anchor based on the layout's
+            // own items per line. Both have to agree on positions and extent.
+            const int itemCount = 1000;
+            const double itemWidth = 100;
+            const double itemHeight = 50;
+            const double spacing = 10;
+            // The last item of a line does not need room for its spacing: (320 + 10) / 110 = 3 items per line.
+            const int itemsPerLine = 3;
+            const int lineCount = (itemCount + itemsPerLine - 1) / itemsPerLine;
+            const double expectedExtentHeight = lineCount * (itemHeight + spacing) - spacing;
+            ItemsRepeater repeater = null;
+            ScrollViewer scrollViewer = null;
+            ManualResetEvent viewChanged = new ManualResetEvent(false);
+
+            Action<string> validateRealizedItems = (string step) =>
+            {
+                Log.Comment(step);
+                int realizedCount = 0;
+                for (int i = 0; i < itemCount; i++)
+                {
+                    var element = repeater.TryGetElement(i) as FrameworkElement;
+                    if (element != null)
+                    {
+                        var expectedRect = new Rect(
+                            (i % itemsPerLine) * (itemWidth + spacing),
+                            (i / itemsPerLine) * (itemHeight + spacing),
+                            itemWidth,
+                            itemHeight);
+                        Verify.AreEqual(expectedRect, LayoutInformation.GetLayoutSlot(element), "Layout slot of item " + i);
+                        realizedCount++;
+                    }
+                }
+
+                Verify.IsGreaterThan(realizedCount, 0);
+                Verify.AreEqual(expectedExtentHeight, repeater.DesiredSize.Height);
+                Verify.AreEqual(expectedExtentHeight, scrollViewer.ExtentHeight);
+            };
+
+            RunOnUIThread.Execute(() =>
+            {
+                repeater = new ItemsRepeater()
+                {
+                    ItemsSource = Enumerable.Range(0, itemCount),
+                    ItemTemplate = GetDataTemplate(@"<Border Width='100' Height='50'/>"),
+                    Layout = new UniformGridLayout()
+                    {
+                        MinItemWidth = itemWidth,
+                        MinItemHeight = itemHeight,
+                        MinColumnSpacing = spacing,
+                        MinRowSpacing = spacing,
+                        ItemsJustification = UniformGridLayoutItemsJustification.Start,
+                        ItemsStretch = UniformGridLayoutItemsStretch.None,
+                    },
+                    HorizontalAlignment = HorizontalAlignment.Left,
+                    HorizontalCacheLength = 0,
+                    VerticalCacheLength = 0,
+                };
+
+                scrollViewer = new ScrollViewer()
+                {
+                    Content = repeater,
+                    Width = 320,
+                    Height = 200,
+                };
+
+                scrollViewer.ViewChanged += (sender, args) =>
+                {
+                    if (!args.IsIntermediate)
+                    {
+                        viewChanged.Set();
+                    }
+                };
+
+                Content = new ItemsRepeaterScrollHost() { ScrollViewer = scrollViewer };
+                Content.UpdateLayout();
+
+                validateRealizedItems("Closed form");
+                Verify.IsNull(repeater.TryGetElement(900));
+
+                viewChanged.Reset();
+                repeater.GetOrCreateElement(900).StartBringIntoView();
+            });
+
+            IdleSynchronizer.Wait();
+            Verify.IsTrue(viewChanged.WaitOne(DefaultWaitTime));
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.IsNotNull(repeater.TryGetElement(900));
+                validateRealizedItems("After BringIntoView");
+            });
+        }
+
         #region Private Helpers
 
         private enum LayoutChoice
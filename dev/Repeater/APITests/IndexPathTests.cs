@@ -1,6 +1,7 @@
 ﻿// Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License. See LICENSE in the project root for license information.
 
+using System.Collections.Generic;
 using Windows.UI.Xaml.Controls;
 using MUXControlsTestApp.Utilities;
 using Common;
@@ -59,5 +60,29 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
                 Verify.AreEqual(1, path12.CompareTo(path1));
             });
         }
+
+        [TestMethod]
+        public void ValidateDeepIndexPath()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                // Deeper than the inline storage of the path.
+                var deepIndices = new List<int> { 0, 1, 2, 3, 4, 5 };
+                var deepPath = IndexPath.CreateFromIndices(deepIndices);
+                Verify.AreEqual(6, deepPath.GetSize());
+                for (int i = 0; i < deepIndices.Count; i++)
+                {
+                    Verify.AreEqual(deepIndices[i], deepPath.GetAt(i));
+                }
+
+                Verify.AreEqual("R.0.1.2.3.4.5", deepPath.ToString());
+                Verify.AreEqual(0, deepPath.CompareTo(IndexPath.CreateFromIndices(new List<int> { 0, 1, 2, 3, 4, 5 })));
+                Verify.AreEqual(-1, deepPath.CompareTo(IndexPath.CreateFromIndices(new List<int> { 0, 1, 2, 3, 4, 6 })));
+                Verify.AreEqual(1, deepPath.CompareTo(IndexPath.CreateFromIndices(new List<int> { 0, 1, 2, 3, 4 })));
+                Verify.AreEqual(-1, deepPath.CompareTo(IndexPath.CreateFromIndices(new List<int> { 0, 1, 2, 3, 4, 5, 0 })));
+                Verify.AreEqual(1, deepPath.CompareTo(IndexPath.CreateFrom(0, 0)));
+                Verify.AreEqual(-1, IndexPath.CreateFrom(0, -1).CompareTo(IndexPath.CreateFrom(0, 0)));
+            });
+        }
     }
 }
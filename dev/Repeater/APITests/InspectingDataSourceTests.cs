@@ -7,6 +7,7 @@ using System.Collections;
 using System.Collections.Generic;
 using System.Collections.ObjectModel;
 using System.Collections.Specialized;
+using System.Diagnostics;
 using System.Linq;
 using Windows.Foundation.Collections;
 using Windows.UI.Xaml.Controls;
@@ -29,6 +30,7 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
 #if !BUILD_WINDOWS
     using ItemsSourceView = Microsoft.UI.Xaml.Controls.ItemsSourceView;
     using IKeyIndexMapping = Microsoft.UI.Xaml.Controls.IKeyIndexMapping;
+    using RepeaterTestHooks = Microsoft.UI.Private.Controls.RepeaterTestHooks;
 #endif
 
     [TestClass]
@@ -45,6 +47,297 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateIterableIsReadOnDemand()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                const int itemCount = 1000;
+                int yielded = 0;
+                IEnumerable<int> Generate()
+                {
+                    for (int i = 0; i < itemCount; i++)
+                    {
+                        yielded++;
+                        yield return i;
+                    }
+                }
+
+                Log.Comment("Without on demand iteration the first read copies the whole sequence.");
+                var dataSource = new ItemsSourceView(Generate());
+                Verify.IsFalse(dataSource.IsOnDemandIterationEnabled);
+                Verify.AreEqual(10, dataSource.GetAt(10));
+                Verify.AreEqual(itemCount, yielded);
+                Verify.AreEqual(itemCount, dataSource.Count);
+                Verify.AreEqual(itemCount, yielded);
+
+                Log.Comment("With on demand iteration only the items up to the requested index are pulled.");
+                yielded = 0;
+                dataSource = new ItemsSourceView(Generate()) { IsOnDemandIterationEnabled = true };
+                Verify.AreEqual(0, yielded, "Creating the view should not walk the sequence.");
+                Verify.AreEqual(10, dataSource.GetAt(10));
+                Verify.AreEqual(11, yielded);
+                Verify.AreEqual(5, dataSource.GetAt(5));
+                Verify.AreEqual(11, yielded);
+
+                Log.Comment("Count drains the same iterator instead of walking the sequence again.");
+                Verify.AreEqual(itemCount, dataSource.Count);
+                Verify.AreEqual(itemCount, yielded);
+                Verify.AreEqual(itemCount - 1, dataSource.GetAt(itemCount - 1));
+            });
+        }
+
+        [TestMethod]
+        public void ValidateOnDemandIterationOfUnstableSequence()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                // Every enumeration of this sequence is shorter than the previous one. Count has
+                // to match the items that were actually cached, or the last ones would be missing.
+                int enumerations = 0;
+                IEnumerable<int> Generate()
+                {
+                    int length = 100 - 10 * enumerations++;
+                    for (int i = 0; i < length; i++)
+                    {
+                        yield return i;
+                    }
+                }
+
+                var dataSource = new ItemsSourceView(Generate()) { IsOnDemandIterationEnabled = true };
+                Verify.AreEqual(20, dataSource.GetAt(20));
+                Verify.AreEqual(100, dataSource.Count);
+                Verify.AreEqual(1, enumerations);
+                Verify.AreEqual(99, dataSource.GetAt(99));
+
+                var items = new object[10];
+                Verify.AreEqual(10u, dataSource.GetMany(90, items));
+                Verify.AreEqual(99, items[9]);
+            });
+        }
+
+        [TestMethod]
+        public void ValidateKeyIndexCacheWithLargeCollection()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                const int itemCount = 100000;
+                var data = new KeyedObservableCollection(Enumerable.Range(0, itemCount).Select(i => "Key #" + i));
+                var dataSource = new ItemsSourceView(data);
+                Verify.IsTrue(dataSource.HasKeyIndexMapping);
+
+                // The source's own IndexFromKey is a linear search, so looking every key up
+                // through it would be quadratic.
+                var stopwatch = Stopwatch.StartNew();
+                for (int i = 0; i < itemCount; i++)
+                {
+                    Verify.AreEqual(i, dataSource.IndexFromKey("Key #" + i));
+                }
+                Log.Comment(string.Format("IndexFromKey for {0} keys: {1} ms", itemCount, stopwatch.ElapsedMilliseconds));
+
+                stopwatch.Restart();
+                data.Move(0, itemCount - 1);
+                data.Move(itemCount / 2, 0);
+                Verify.AreEqual(itemCount - 1, dataSource.IndexFromKey("Key #0"));
+                Verify.AreEqual(0, dataSource.IndexFromKey("Key #" + (itemCount / 2 + 1)));
+                Verify.AreEqual(1, dataSource.IndexFromKey("Key #1"));
+                Verify.AreEqual("Key #0", dataSource.KeyFromIndex(itemCount - 1));
+                Log.Comment(string.Format("Moves with lookups: {0} ms", stopwatch.ElapsedMilliseconds));
+
+                data.RemoveAt(1);
+                data.Insert(itemCount - 2, "Inserted");
+                Verify.AreEqual(itemCount - 2, dataSource.IndexFromKey("Inserted"));
+                Verify.AreEqual(itemCount - 1, dataSource.IndexFromKey("Key #0"));
+                Verify.AreEqual(-1, dataSource.IndexFromKey("Key #1"));
+
+                stopwatch.Restart();
+                data.ResetTo(Enumerable.Range(0, itemCount).Reverse().Select(i => "Key #" + i));
+                for (int i = 0; i < itemCount; i += 1000)
+                {
+                    Verify.AreEqual(itemCount - 1 - i, dataSource.IndexFromKey("Key #" + i));
+                }
+                Log.Comment(string.Format("Reset with lookups: {0} ms", stopwatch.ElapsedMilliseconds));
+            });
+        }
+
+        [TestMethod]
+        public void ValidateResetDiffing()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var data = new KeyedObservableCollection(Enumerable.Range(0, 10).Select(i => "Key #" + i));
+                var dataSource = new ItemsSourceView(data);
+                dataSource.IsResetDiffingEnabled = true;
+                var recorder = new CollectionChangeRecorder(dataSource);
+
+                // Drop Key #2 and add a new key after Key #5.
+                data.ResetTo(new string[] { "Key #0", "Key #1", "Key #3", "Key #4", "Key #5", "New", "Key #6", "Key #7", "Key #8", "Key #9" });
+
+                VerifyRecordedCollectionChanges(
+                    expected: new NotifyCollectionChangedEventArgs[]
+                    {
+                        CollectionChangeEventArgsConverters.CreateNotifyArgs(NotifyCollectionChangedAction.Remove, 2, 1, -1, 0),
+                        CollectionChangeEventArgsConverters.CreateNotifyArgs(NotifyCollectionChangedAction.Add, -1, 0, 5, 1),
+                    },
+                    actual: recorder.RecordedArgs);
+                Verify.AreEqual(10, dataSource.Count);
+                Verify.AreEqual(5, dataSource.IndexFromKey("New"));
+
+                // Nothing in common, so a plain Reset is cheaper than the edits.
+                recorder.RecordedArgs.Clear();
+                data.ResetTo(Enumerable.Range(100, 3000).Select(i => "Key #" + i));
+                VerifyRecordedCollectionChanges(
+                    expected: new NotifyCollectionChangedEventArgs[]
+                    {
+                        CollectionChangeEventArgsConverters.CreateNotifyArgs(NotifyCollectionChangedAction.Reset, -1, 0, -1, 0),
+                    },
+                    actual: recorder.RecordedArgs);
+                Verify.AreEqual(3000, dataSource.Count);
+            });
+        }
+
+        [TestMethod]
+        public void ValidateResetDiffingAfterAddWithoutIndex()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var data = new KeyedObservableCollection(Enumerable.Range(0, 10).Select(i => "Key #" + i));
+                var dataSource = new ItemsSourceView(data);
+                dataSource.IsResetDiffingEnabled = true;
+                var recorder = new CollectionChangeRecorder(dataSource);
+
+                // The key snapshot cannot be patched for this one and has to be taken again.
+                data.AddWithoutIndex("Key #10");
+                Verify.AreEqual(11, dataSource.Count);
+
+                // Drop Key #0.
+                recorder.RecordedArgs.Clear();
+                data.ResetTo(Enumerable.Range(1, 10).Select(i => "Key #" + i));
+
+                VerifyRecordedCollectionChanges(
+                    expected: new NotifyCollectionChangedEventArgs[]
+                    {
+                        CollectionChangeEventArgsConverters.CreateNotifyArgs(NotifyCollectionChangedAction.Remove, 0, 1, -1, 0),
+                    },
+                    actual: recorder.RecordedArgs);
+                Verify.AreEqual(10, dataSource.Count);
+                Verify.AreEqual(9, dataSource.IndexFromKey("Key #10"));
+            });
+        }
+
+        [TestMethod]
+        public void ValidateResetDiffingPassesItemsAndReplacesChangedItems()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var items = Enumerable.Range(0, 5).Select(i => new KeyedItem("Key #" + i)).ToArray();
+                var data = new KeyedItemCollection(items);
+                var dataSource = new ItemsSourceView(data);
+                dataSource.IsResetDiffingEnabled = true;
+                var recorder = new CollectionChangeRecorder(dataSource);
+                var recordedItems = new List<Tuple<IList, IList>>();
+                var itemsAtIndex1 = new List<object>();
+                dataSource.CollectionChanged += (sender, args) =>
+                {
+                    recordedItems.Add(Tuple.Create<IList, IList>(
+                        args.OldItems == null ? null : args.OldItems.Cast<object>().ToList(),
+                        args.NewItems == null ? null : args.NewItems.Cast<object>().ToList()));
+                    itemsAtIndex1.Add(dataSource.GetAt(1));
+                };
+
+                // Drop Key #2, add a new key at the end and replace the items of Key #1 and
+                // Key #4 with new objects that have the same keys.
+                var newKey1 = new KeyedItem("Key #1");
+                var newKey4 = new KeyedItem("Key #4");
+                var added = new KeyedItem("New");
+                data.ResetTo(new KeyedItem[] { items[0], newKey1, items[3], newKey4, added });
+
+                VerifyRecordedCollectionChanges(
+                    expected: new NotifyCollectionChangedEventArgs[]
+                    {
+                        CollectionChangeEventArgsConverters.CreateNotifyArgs(NotifyCollectionChangedAction.Remove, 2, 1, -1, 0),
+                        CollectionChangeEventArgsConverters.CreateNotifyArgs(NotifyCollectionChangedAction.Add, -1, 0, 4, 1),
+                        CollectionChangeEventArgsConverters.CreateNotifyArgs(NotifyCollectionChangedAction.Replace, 1, 1, 1, 1),
+                        CollectionChangeEventArgsConverters.CreateNotifyArgs(NotifyCollectionChangedAction.Replace, 3, 1, 3, 1),
+                    },
+                    actual: recorder.RecordedArgs);
+
+                Verify.AreEqual(items[2], recordedItems[0].Item1[0]);
+                Verify.AreEqual(added, recordedItems[1].Item2[0]);
+                Verify.AreEqual(items[1], recordedItems[2].Item1[0]);
+                Verify.AreEqual(newKey1, recordedItems[2].Item2[0]);
+                Verify.AreEqual(items[4], recordedItems[3].Item1[0]);
+                Verify.AreEqual(newKey4, recordedItems[3].Item2[0]);
+
+                // GetAt reads the source, which already holds the final items while the edits are raised.
+                Verify.AreEqual(newKey1, itemsAtIndex1[0]);
+
+                // The snapshot follows regular changes too: only the moved item's key changes
+                // position and nothing is replaced.
+                data.Move(0, 4);
+                recorder.RecordedArgs.Clear();
+                data.ResetTo(data.ToArray());
+                VerifyRecordedCollectionChanges(
+                    expected: new NotifyCollectionChangedEventArgs[0],
+                    actual: recorder.RecordedArgs);
+            });
+        }
+
+        [TestMethod]
+        public void ValidateItemCacheAndGetMany()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var dataSource = new ItemsSourceView(Enumerable.Range(0, 300));
+                RepeaterTestHooks.ResetItemsSourceViewCacheCounters(dataSource);
+
+                for (int i = 0; i < dataSource.Count; i++)
+                {
+                    Verify.AreEqual(i, dataSource.GetAt(i));
+                }
+
+                int hits = RepeaterTestHooks.GetItemsSourceViewCacheHitCount(dataSource);
+                int misses = RepeaterTestHooks.GetItemsSourceViewCacheMissCount(dataSource);
+                Log.Comment(string.Format("Sequential read of {0} items: {1} hits, {2} misses", dataSource.Count, hits, misses));
+                // One miss per 64 item window.
+                Verify.AreEqual(5, misses);
+                Verify.AreEqual(295, hits);
+
+                var items = new object[20];
+                Verify.AreEqual(20u, dataSource.GetMany(10, items));
+                for (int i = 0; i < items.Length; i++)
+                {
+                    Verify.AreEqual(10 + i, items[i]);
+                }
+
+                Verify.AreEqual(10u, dataSource.GetMany(290, items));
+                Verify.AreEqual(299, items[9]);
+                Verify.AreEqual(0u, dataSource.GetMany(300, items));
+            });
+        }
+
+        [TestMethod]
+        public void ValidateItemCacheIsInvalidatedOnCollectionChange()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var data = new ObservableCollection<string>(Enumerable.Range(0, 100).Select(i => string.Format("Item #{0}", i)));
+                var dataSource = new ItemsSourceView(data);
+                Verify.AreEqual("Item #4", (string)dataSource.GetAt(4));
+                Verify.AreEqual("Item #5", (string)dataSource.GetAt(5));
+
+                data[4] = "Replaced Item";
+                Verify.AreEqual("Replaced Item", (string)dataSource.GetAt(4));
+
+                data.Insert(0, "Inserted Item");
+                Verify.AreEqual("Inserted Item", (string)dataSource.GetAt(0));
+                Verify.AreEqual("Item #5", (string)dataSource.GetAt(6));
+
+                data.RemoveAt(0);
+                Verify.AreEqual("Item #5", (string)dataSource.GetAt(5));
+            });
+        }
+
         [TestMethod]
         public void CanCreateFromInccIBindableVector()
         {
@@ -330,6 +623,75 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             }
         }
 
+        class KeyedObservableCollection : ObservableCollection<string>, IKeyIndexMapping
+        {
+            public KeyedObservableCollection(IEnumerable<string> data) : base(data) { }
+
+            public string KeyFromIndex(int index)
+            {
+                return this[index];
+            }
+
+            public int IndexFromKey(string key)
+            {
+                return IndexOf(key);
+            }
+
+            public void ResetTo(IEnumerable<string> data)
+            {
+                Items.Clear();
+                foreach (var item in data)
+                {
+                    Items.Add(item);
+                }
+
+                OnCollectionChanged(new NotifyCollectionChangedEventArgs(NotifyCollectionChangedAction.Reset));
+            }
+
+            // Raises an Add notification without the index of the new item.
+            public void AddWithoutIndex(string item)
+            {
+                Items.Add(item);
+                OnCollectionChanged(new NotifyCollectionChangedEventArgs(NotifyCollectionChangedAction.Add, item));
+            }
+        }
+
+        class KeyedItem
+        {
+            public KeyedItem(string key)
+            {
+                Key = key;
+            }
+
+            public string Key { get; private set; }
+        }
+
+        class KeyedItemCollection : ObservableCollection<KeyedItem>, IKeyIndexMapping
+        {
+            public KeyedItemCollection(IEnumerable<KeyedItem> data) : base(data) { }
+
+            public string KeyFromIndex(int index)
+            {
+                return this[index].Key;
+            }
+
+            public int IndexFromKey(string key)
+            {
+                return IndexOf(this.First(item => item.Key == key));
+            }
+
+            public void ResetTo(IEnumerable<KeyedItem> data)
+            {
+                Items.Clear();
+                foreach (var item in data)
+                {
+                    Items.Add(item);
+                }
+
+                OnCollectionChanged(new NotifyCollectionChangedEventArgs(NotifyCollectionChangedAction.Reset));
+            }
+        }
+
         class ObservableVectorWithUniqueIds : ObservableCollection<int>, IKeyIndexMapping
         {
             public ObservableVectorWithUniqueIds(IEnumerable<int> data) : base(data) { }
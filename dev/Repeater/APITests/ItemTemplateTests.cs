@@ -3,9 +3,11 @@
 
 using Common;
 using MUXControlsTestApp.Utilities;
+using System;
 using System.Collections.Generic;
 using System.Linq;
 using System.Runtime.InteropServices;
+using System.Threading;
 using Windows.UI.Xaml;
 using Windows.UI.Xaml.Controls;
 using Windows.UI.Xaml.Markup;
@@ -398,6 +400,65 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidatePrewarmAndTemplateStatistics()
+        {
+            const string key = "key";
+            const int prewarmCount = 5;
+            RecyclePool pool = null;
+            RecyclingElementFactory elementFactory = null;
+            ManualResetEvent buildTreeCompleted = new ManualResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                pool = new RecyclePool();
+                elementFactory = new RecyclingElementFactory() { RecyclePool = pool };
+                elementFactory.Templates[key] = (DataTemplate)XamlReader.Load(
+                    @"<DataTemplate  xmlns='http://schemas.microsoft.com/winfx/2006/xaml/presentation'>
+                         <TextBlock Text='{Binding}' />
+                    </DataTemplate>");
+
+                Verify.Throws<COMException>(delegate
+                {
+                    elementFactory.Prewarm("unknownKey", 1);
+                });
+
+                RepeaterTestHooks.BuildTreeCompleted += (sender, args) =>
+                {
+                    buildTreeCompleted.Set();
+                };
+
+                elementFactory.Prewarm(key, prewarmCount);
+                Verify.AreEqual(0u, elementFactory.GetTemplateStatistics(key).InflateCount);
+            });
+
+            Verify.IsTrue(buildTreeCompleted.WaitOne(TimeSpan.FromMilliseconds(2000)), "Waiting for prewarm to complete.");
+
+            RunOnUIThread.Execute(() =>
+            {
+                var statistics = elementFactory.GetTemplateStatistics(key);
+                Verify.AreEqual((uint)prewarmCount, statistics.InflateCount);
+                Verify.AreEqual(0u, statistics.HitCount);
+                Verify.AreEqual(0u, statistics.MissCount);
+
+                var context = (ElementFactoryGetArgs)RepeaterTestHooks.CreateRepeaterElementFactoryGetArgs();
+                context.Parent = null;
+                context.Data = 0;
+                for (int i = 0; i < prewarmCount + 1; i++)
+                {
+                    Verify.IsNotNull(elementFactory.GetElement(context));
+                }
+
+                statistics = elementFactory.GetTemplateStatistics(key);
+                Verify.AreEqual((uint)prewarmCount, statistics.HitCount);
+                Verify.AreEqual(1u, statistics.MissCount);
+                Verify.AreEqual((uint)prewarmCount + 1, statistics.InflateCount);
+
+                elementFactory.ResetTemplateStatistics();
+                Verify.AreEqual(0u, elementFactory.GetTemplateStatistics(key).InflateCount);
+            });
+        }
+
         // Validate ability to create and use a view generator from scratch
         [TestMethod]
         public void ValidateCustomElementFactory()
@@ -5,6 +5,7 @@ using Common;
 using MUXControlsTestApp.Utilities;
 using System;
 using System.Collections.Generic;
+using System.Diagnostics;
 using System.Linq;
 using System.Threading;
 using Windows.UI.Xaml;
@@ -25,6 +26,7 @@ using ItemsRepeater = Microsoft.UI.Xaml.Controls.ItemsRepeater;
 using ElementFactory = Microsoft.UI.Xaml.Controls.ElementFactory;
 using RecyclePool = Microsoft.UI.Xaml.Controls.RecyclePool;
 using StackLayout = Microsoft.UI.Xaml.Controls.StackLayout;
+using UniformGridLayout = Microsoft.UI.Xaml.Controls.UniformGridLayout;
 using ItemsRepeaterScrollHost = Microsoft.UI.Xaml.Controls.ItemsRepeaterScrollHost;
 using RepeaterTestHooks = Microsoft.UI.Private.Controls.RepeaterTestHooks;
 #endif
@@ -191,6 +193,69 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             }
         }
 
+        // Reports the time it takes for the realized items of a large grid to reach their last phase.
+        [TestMethod]
+        public void ValidateTimeToFullyPhasedForLargeGrid()
+        {
+            ItemsRepeater repeater = null;
+            const int numItems = 3000;
+            const int numPhases = 6;
+            var stopwatch = new Stopwatch();
+            ManualResetEvent buildTreeCompleted = new ManualResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                ElementPhasingManager.IsLoggingEnabled = false;
+                ElementPhasingManager.ProcessedCalls?.Clear();
+
+                repeater = new ItemsRepeater()
+                {
+                    ItemsSource = Enumerable.Range(0, numItems),
+#if BUILD_WINDOWS
+                    ItemTemplate = (Windows.UI.Xaml.IElementFactory)new CustomElementFactory(numPhases),
+#else
+                    ItemTemplate = new CustomElementFactory(numPhases),
+#endif
+                    Layout = new UniformGridLayout() { MinItemWidth = 100, MinItemHeight = 100 },
+                };
+
+                Content = new ItemsRepeaterScrollHost()
+                {
+                    Width = 800,
+                    Height = 800,
+                    ScrollViewer = new ScrollViewer
+                    {
+                        Content = repeater
+                    }
+                };
+
+                stopwatch.Start();
+                Content.UpdateLayout();
+
+                RepeaterTestHooks.BuildTreeCompleted += (sender, args) =>
+                {
+                    stopwatch.Stop();
+                    buildTreeCompleted.Set();
+                };
+            });
+
+            Verify.IsTrue(buildTreeCompleted.WaitOne(TimeSpan.FromMilliseconds(10000)), "Waiting for phasing to complete.");
+
+            RunOnUIThread.Execute(() =>
+            {
+                var calls = ElementPhasingManager.ProcessedCalls;
+                Log.Comment(string.Format("Phased {0} items to phase {1} in {2}ms", calls.Count, numPhases - 1, stopwatch.ElapsedMilliseconds));
+
+                foreach (var index in calls.Keys)
+                {
+                    Verify.AreEqual(numPhases - 1, calls[index].Last());
+                }
+
+                ElementPhasingManager.ProcessedCalls.Clear();
+                ElementPhasingManager.IsLoggingEnabled = true;
+            });
+        }
+
         private class CustomElementFactory : ElementFactory
         {
             private int _numPhases;
@@ -233,6 +298,8 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             // data index -> list<phases>
             public static Dictionary<int, List<int>> ProcessedCalls { get; set; }
 
+            public static bool IsLoggingEnabled { get; set; } = true;
+
             public ElementPhasingManager(int numPhases)
             {
                 _numPhases = numPhases;
@@ -241,7 +308,10 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             public void Recycle()
             {
                 IsCleared = true;
-                Log.Comment(string.Format("Recycle Index:{0}", _data));
+                if (IsLoggingEnabled)
+                {
+                    Log.Comment(string.Format("Recycle Index:{0}", _data));
+                }
             }
 
             public void ProcessBindings(object item, int itemIndex, int phase, out int nextPhase)
@@ -266,7 +336,10 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
                 ProcessedCalls[_data].Add(phase);
 
                 nextPhase = phase >= _numPhases -1 ? -1 : phase + 1;
-                Log.Comment(string.Format("Index:{0}  Phase:{1}  NextPhase:{2}", item.ToString(), phase, nextPhase));
+                if (IsLoggingEnabled)
+                {
+                    Log.Comment(string.Format("Index:{0}  Phase:{1}  NextPhase:{2}", item.ToString(), phase, nextPhase));
+                }
             }
         }
     }
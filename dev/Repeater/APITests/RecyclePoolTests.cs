@@ -219,5 +219,54 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
                 Verify.IsNull(recycled2.Parent);
             });
         }
+
+        [TestMethod]
+        public void ValidateMaxElementsPerKeyAndCounters()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                const string key = "Key";
+                const string otherKey = "OtherKey";
+                RecyclePool pool = new RecyclePool();
+                Verify.AreEqual(-1, pool.MaxElementsPerKey);
+
+                var owner = new StackPanel();
+                var children = Enumerable.Range(0, 5).Select(i => new Button()).ToList();
+                foreach (var child in children)
+                {
+                    owner.Children.Add(child);
+                }
+
+                pool.MaxElementsPerKey = 3;
+                foreach (var child in children)
+                {
+                    pool.PutElement(child, key, owner);
+                }
+                pool.PutElement(new TextBlock(), otherKey);
+
+                // The two least recently recycled elements are evicted and removed from the owner.
+                Verify.AreEqual(2ul, pool.EvictionCount);
+                Verify.AreEqual(3, owner.Children.Count);
+                Verify.AreEqual(-1, owner.Children.IndexOf(children[0]));
+                Verify.AreEqual(-1, owner.Children.IndexOf(children[1]));
+
+                // Elements are handed back most recently recycled first.
+                Verify.AreSame(children[4], pool.TryGetElement(key, owner));
+                Verify.AreSame(children[3], pool.TryGetElement(key, owner));
+                Verify.AreSame(children[2], pool.TryGetElement(key, owner));
+                Verify.IsNull(pool.TryGetElement(key, owner));
+                Verify.IsNotNull(pool.TryGetElement(otherKey));
+
+                Verify.AreEqual(4ul, pool.HitCount);
+                Verify.AreEqual(1ul, pool.MissCount);
+
+                // Lowering the limit trims the existing elements.
+                pool.PutElement(new Button(), key);
+                pool.PutElement(new Button(), key);
+                pool.MaxElementsPerKey = 0;
+                Verify.AreEqual(4ul, pool.EvictionCount);
+                Verify.IsNull(pool.TryGetElement(key));
+            });
+        }
     }
 }
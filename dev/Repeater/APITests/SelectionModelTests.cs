@@ -7,6 +7,7 @@ using System.Collections.Generic;
 using System.Linq;
 using System;
 using System.Collections.ObjectModel;
+using System.Runtime.InteropServices;
 using System.Text;
 using Windows.UI.Xaml.Controls;
 using Windows.UI.Xaml.Data;
@@ -26,6 +27,7 @@ using SelectionModel = Microsoft.UI.Xaml.Controls.SelectionModel;
 using IndexPath = Microsoft.UI.Xaml.Controls.IndexPath;
 using SelectionModelSelectionChangedEventArgs = Microsoft.UI.Xaml.Controls.SelectionModelSelectionChangedEventArgs;
 using SelectionModelChildrenRequestedEventArgs = Microsoft.UI.Xaml.Controls.SelectionModelChildrenRequestedEventArgs;
+using RepeaterTestHooks = Microsoft.UI.Private.Controls.RepeaterTestHooks;
 #endif
 
 namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
@@ -683,6 +685,213 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateSelectedIndicesRandomAccessAcrossGroups()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                SelectionModel selectionModel = new SelectionModel();
+                selectionModel.Source = CreateNestedData(1 /* levels */ , 4 /* groupsAtLevel */, 5 /* countAtLeaf */);
+
+                selectionModel.SelectRange(Path(0, 1), Path(0, 2));
+                selectionModel.SelectRange(Path(2, 0), Path(3, 1));
+                selectionModel.Deselect(2, 3);
+
+                var expected = new List<IndexPath>()
+                {
+                    Path(0, 1),
+                    Path(0, 2),
+                    Path(2, 0),
+                    Path(2, 1),
+                    Path(2, 2),
+                    Path(2, 4),
+                    Path(3, 0),
+                    Path(3, 1)
+                };
+
+                var selectedIndices = selectionModel.SelectedIndices;
+                Verify.AreEqual(expected.Count, selectedIndices.Count);
+
+                // Random access in reverse order and enumeration have to agree.
+                for (int i = expected.Count - 1; i >= 0; i--)
+                {
+                    Verify.AreEqual(0, expected[i].CompareTo(selectedIndices[i]), "Index " + i);
+                }
+
+                var enumerated = selectedIndices.ToList();
+                Verify.AreEqual(expected.Count, enumerated.Count);
+                for (int i = 0; i < expected.Count; i++)
+                {
+                    Verify.AreEqual(0, expected[i].CompareTo(enumerated[i]), "Enumerated index " + i);
+                }
+
+                var selectedItems = selectionModel.SelectedItems.ToList();
+                Verify.AreEqual(expected.Count, selectedItems.Count);
+                for (int i = 0; i < expected.Count; i++)
+                {
+                    Verify.AreEqual(GetData(selectionModel, expected[i]), selectedItems[i]);
+                }
+            });
+        }
+
+        [TestMethod]
+        public void ValidateBatchRaisesSingleSelectionChanged()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                var selectionModel = new SelectionModel();
+                selectionModel.Source = Enumerable.Range(0, 10000).ToList();
+                int selectionChangedCount = 0;
+                int selectedIndicesChangedCount = 0;
+                selectionModel.SelectionChanged += (sender, args) => { selectionChangedCount++; };
+                selectionModel.PropertyChanged += (sender, args) =>
+                {
+                    if (args.PropertyName == "SelectedIndices")
+                    {
+                        selectedIndicesChangedCount++;
+                    }
+                };
+
+                selectionModel.BeginBatch();
+                for (int i = 0; i < 10000; i += 2)
+                {
+                    selectionModel.Select(i);
+                }
+
+                // Nested batches only raise when the outermost one ends.
+                selectionModel.BeginBatch();
+                selectionModel.Deselect(0);
+                selectionModel.EndBatch();
+                Verify.AreEqual(0, selectionChangedCount);
+
+                // Reads inside the batch see the current selection.
+                Verify.AreEqual(4999, selectionModel.SelectedIndices.Count);
+
+                selectionModel.EndBatch();
+                Verify.AreEqual(1, selectionChangedCount);
+                Verify.AreEqual(1, selectedIndicesChangedCount);
+                Verify.AreEqual(4999, selectionModel.SelectedIndices.Count);
+                Verify.AreEqual(2, selectionModel.SelectedIndex.GetAt(0));
+
+                // A batch that changes nothing raises nothing.
+                selectionModel.BeginBatch();
+                selectionModel.EndBatch();
+                Verify.AreEqual(1, selectionChangedCount);
+
+                Verify.Throws<COMException>(() => selectionModel.EndBatch());
+            });
+        }
+
+        [TestMethod]
+        public void ValidateLargeRangeSelection()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                const int itemCount = 1000000;
+                var selectionModel = new SelectionModel();
+                selectionModel.Source = Enumerable.Range(0, itemCount).ToList();
+                var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+
+                selectionModel.SelectAll();
+                Log.Comment(string.Format("SelectAll: {0}ms", stopwatch.ElapsedMilliseconds));
+                Verify.AreEqual(itemCount, selectionModel.SelectedIndices.Count);
+
+                stopwatch.Restart();
+                for (int i = 0; i < 1000; i++)
+                {
+                    // Punch 1000 holes of 10 items each.
+                    selectionModel.DeselectRange(Path(i * 1000), Path(i * 1000 + 9));
+                }
+                Log.Comment(string.Format("DeselectRange x1000: {0}ms", stopwatch.ElapsedMilliseconds));
+                Verify.AreEqual(itemCount - 10000, selectionModel.SelectedIndices.Count);
+
+                stopwatch.Restart();
+                selectionModel.SetAnchorIndex(5);
+                selectionModel.SelectRangeFromAnchor(itemCount - 5);
+                Log.Comment(string.Format("SelectRangeFromAnchor: {0}ms", stopwatch.ElapsedMilliseconds));
+                Verify.AreEqual(itemCount - 10, selectionModel.SelectedIndices.Count);
+
+                stopwatch.Restart();
+                int selectedCount = 0;
+                for (int i = 0; i < itemCount; i += 97)
+                {
+                    if (selectionModel.IsSelected(i).Value)
+                    {
+                        selectedCount++;
+                    }
+                }
+                Log.Comment(string.Format("IsSelected x{0}: {1}ms", itemCount / 97 + 1, stopwatch.ElapsedMilliseconds));
+                Verify.IsGreaterThan(selectedCount, 0);
+
+                stopwatch.Restart();
+                Verify.AreEqual(Path(5), selectionModel.SelectedIndices[0]);
+                Verify.AreEqual(Path(itemCount / 2), selectionModel.SelectedIndices[itemCount / 2 - 5]);
+                Verify.AreEqual(Path(itemCount - 1), selectionModel.SelectedIndices[itemCount - 11]);
+                Log.Comment(string.Format("SelectedIndices lookups: {0}ms", stopwatch.ElapsedMilliseconds));
+            });
+        }
+
+        [TestMethod]
+        public void ValidateUnselectedNodesAreEvicted()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                // 10 x 10 x 10 groups of 10 items, 1111 non-leaf nodes including the root.
+                var selectionModel = new SelectionModel();
+                selectionModel.Source = CreateNestedData(3 /* levels */, 10 /* groupsAtLevel */, 10 /* countAtLeaf */);
+                Verify.AreEqual(1, RepeaterTestHooks.GetSelectionModelRealizedNodeCount(selectionModel));
+
+                var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+                selectionModel.SelectRange(Path(0, 0, 0, 0), Path(9, 9, 9, 9));
+                Log.Comment(string.Format("SelectRange: {0}ms, {1} nodes", stopwatch.ElapsedMilliseconds, RepeaterTestHooks.GetSelectionModelRealizedNodeCount(selectionModel)));
+                Verify.AreEqual(10000, selectionModel.SelectedIndices.Count);
+                Verify.AreEqual(1111, RepeaterTestHooks.GetSelectionModelRealizedNodeCount(selectionModel));
+
+                stopwatch.Restart();
+                selectionModel.DeselectRange(Path(0, 0, 0, 0), Path(9, 9, 9, 9));
+                Log.Comment(string.Format("DeselectRange: {0}ms, {1} nodes", stopwatch.ElapsedMilliseconds, RepeaterTestHooks.GetSelectionModelRealizedNodeCount(selectionModel)));
+                Verify.AreEqual(0, selectionModel.SelectedIndices.Count);
+                Verify.AreEqual(1, RepeaterTestHooks.GetSelectionModelRealizedNodeCount(selectionModel));
+
+                // Toggle every item on and off again. Only the nodes on the anchor path stay behind.
+                stopwatch.Restart();
+                int peakNodeCount = 0;
+                for (int i = 0; i < 10; i++)
+                {
+                    for (int j = 0; j < 10; j++)
+                    {
+                        for (int k = 0; k < 10; k++)
+                        {
+                            for (int l = 0; l < 10; l++)
+                            {
+                                selectionModel.SelectAt(Path(i, j, k, l));
+                                selectionModel.DeselectAt(Path(i, j, k, l));
+                            }
+
+                            peakNodeCount = Math.Max(peakNodeCount, RepeaterTestHooks.GetSelectionModelRealizedNodeCount(selectionModel));
+                        }
+                    }
+                }
+                Log.Comment(string.Format("Select/Deselect x10000: {0}ms, peak {1} nodes", stopwatch.ElapsedMilliseconds, peakNodeCount));
+                Verify.AreEqual(4, peakNodeCount);
+                Verify.AreEqual(4, RepeaterTestHooks.GetSelectionModelRealizedNodeCount(selectionModel));
+                Verify.AreEqual(0, Path(9, 9, 9, 9).CompareTo(selectionModel.AnchorIndex));
+
+                // Evicted nodes are realized again on demand and report the same state.
+                selectionModel.SelectAt(Path(3, 4, 5, 6));
+                selectionModel.SelectAt(Path(7, 1, 2, 3));
+                Verify.IsNull(selectionModel.IsSelectedAt(Path(3)));
+                Verify.IsNull(selectionModel.IsSelectedAt(Path(3, 4, 5)));
+                Verify.IsFalse(selectionModel.IsSelectedAt(Path(3, 4, 4)).Value);
+                Verify.IsTrue(selectionModel.IsSelectedAt(Path(7, 1, 2, 3)).Value);
+                Verify.AreEqual(2, selectionModel.SelectedIndices.Count);
+                Verify.AreEqual(7, RepeaterTestHooks.GetSelectionModelRealizedNodeCount(selectionModel));
+
+                selectionModel.ClearSelection();
+                Verify.AreEqual(1, RepeaterTestHooks.GetSelectionModelRealizedNodeCount(selectionModel));
+            });
+        }
+
         [TestMethod]
         public void ValidateClear()
         {
@@ -6,10 +6,21 @@
 #include "QPCTimer.h"
 #include "BuildTreeScheduler.h"
 #include "RepeaterTestHooks.h"
+#include "RepeaterTrace.h"
 
-double BuildTreeScheduler::m_budgetInMs = 40.0;
+double BuildTreeScheduler::m_maxBudgetInMs = 40.0;
 thread_local QPCTimer BuildTreeScheduler::m_timer{};
+thread_local QPCTimer BuildTreeScheduler::m_frameTimer{};
+thread_local double BuildTreeScheduler::m_refreshIntervalInMs = 1000.0 / 60.0;
+thread_local std::array<double, BuildTreeScheduler::s_frameIntervalWindowSize> BuildTreeScheduler::m_frameIntervals{};
+thread_local size_t BuildTreeScheduler::m_frameIntervalCount{};
+thread_local bool BuildTreeScheduler::m_isFrameTimerStarted{};
+thread_local bool BuildTreeScheduler::m_didWorkInLastFrame{};
+thread_local int BuildTreeScheduler::m_idleFramesRemaining{};
+thread_local uint64_t BuildTreeScheduler::m_frameCount{};
+thread_local uint64_t BuildTreeScheduler::m_workSequence{};
 thread_local std::vector<WorkInfo> BuildTreeScheduler::m_pendingWork{};
+thread_local std::array<int, 5> BuildTreeScheduler::m_budgetUsageHistogram{};
 thread_local winrt::event_token BuildTreeScheduler::m_renderingToken{};
 
 void BuildTreeScheduler::RegisterWork(int priority, const std::function<void()>& workFunc)
@@ -18,37 +29,87 @@ void BuildTreeScheduler::RegisterWork(int priority, const std::function<void()>&
     MUX_ASSERT(workFunc != nullptr);
 
     QueueTick();
-    m_pendingWork.push_back(WorkInfo(priority, workFunc));
+
+    // Aging a pending item by one level per s_agingFramesPerPriority frames is the same as
+    // ordering by priority plus registration frame, so the heap order never has to change.
+    const int64_t sortKey = static_cast<int64_t>(priority) * s_agingFramesPerPriority + static_cast<int64_t>(m_frameCount);
+    m_pendingWork.emplace_back(priority, sortKey, m_workSequence++, workFunc);
+    std::push_heap(m_pendingWork.begin(), m_pendingWork.end(), [](const auto& lhs, const auto& rhs) { return lhs.RunsAfter(rhs); });
 }
 
 bool BuildTreeScheduler::ShouldYield()
 {
-    return m_timer.DurationInMilliSeconds() > m_budgetInMs;
+    return m_timer.PreciseDurationInMilliSeconds() > BudgetInMs();
 }
 
-void BuildTreeScheduler::OnRendering(const winrt::IInspectable&, const winrt::IInspectable&)
+void BuildTreeScheduler::MaxBudgetInMs(double value)
 {
-      bool budgetReached = ShouldYield();
-    if (!budgetReached && m_pendingWork.size() > 0)
+    if (value <= 0)
     {
-        // Sort in descending order of priority and work from the end of the list to avoid moving around during erase.
-        std::sort(m_pendingWork.begin(), m_pendingWork.end(), [](const auto& lhs, const auto& rhs) { return lhs.Priority() > rhs.Priority(); });
-        int currentIndex = static_cast<int>(m_pendingWork.size()) - 1;
+        throw winrt::hresult_invalid_argument(L"Budget must be greater than zero.");
+    }
+
+    m_maxBudgetInMs = value;
+}
 
-        do
+double BuildTreeScheduler::BudgetInMs()
+{
+    return std::min(m_maxBudgetInMs, m_refreshIntervalInMs * s_budgetInFrames);
+}
+
+void BuildTreeScheduler::OnRendering(const winrt::IInspectable&, const winrt::IInspectable&)
+{
+    UpdateFrameInterval();
+    ++m_frameCount;
+
+    bool didWork = false;
+    bool budgetReached = ShouldYield();
+    if (!budgetReached)
+    {
+        while (!m_pendingWork.empty())
         {
-            m_pendingWork[currentIndex].InvokeWorkFunc();
-            m_pendingWork.erase(m_pendingWork.begin() + currentIndex);
-        } while (--currentIndex >= 0 && !ShouldYield());
+            std::pop_heap(m_pendingWork.begin(), m_pendingWork.end(), [](const auto& lhs, const auto& rhs) { return lhs.RunsAfter(rhs); });
+            // Take the work out before running it since it can register more work.
+            const auto work = std::move(m_pendingWork.back());
+            m_pendingWork.pop_back();
+            work.InvokeWorkFunc();
+            didWork = true;
+
+            if (ShouldYield())
+            {
+                break;
+            }
+        }
+    }
+
+    m_didWorkInLastFrame = didWork;
+
+    if (didWork || !m_pendingWork.empty())
+    {
+        TraceFrame(m_timer.PreciseDurationInMilliSeconds(), BudgetInMs());
     }
 
     if (m_pendingWork.empty())
     {
-        // No more pending work, unhook from rendering event since being hooked up will case wux to try to 
-        // call the event at 60 frames per second
-        winrt::Windows::UI::Xaml::Media::CompositionTarget::CompositionTarget::Rendering(m_renderingToken);
-        m_renderingToken.value = 0;
-        RepeaterTestHooks::NotifyBuildTreeCompleted();
+        if (didWork)
+        {
+            RepeaterTestHooks::NotifyBuildTreeCompleted();
+            m_idleFramesRemaining = s_idleFramesAfterWork;
+        }
+
+        if (m_idleFramesRemaining > 0)
+        {
+            // Stay hooked for a few frames without work so that UpdateFrameInterval gets to
+            // measure an interval that our own work did not stretch.
+            --m_idleFramesRemaining;
+        }
+        else
+        {
+            // No more pending work, unhook from rendering event since being hooked up will case wux to try to
+            // call the event at 60 frames per second
+            winrt::Windows::UI::Xaml::Media::CompositionTarget::CompositionTarget::Rendering(m_renderingToken);
+            m_renderingToken.value = 0;
+        }
     }
 
     // Reset the timer so it snaps the time just before rendering
@@ -60,5 +121,53 @@ void  BuildTreeScheduler::QueueTick()
     if (m_renderingToken.value == 0)
     {
         m_renderingToken = winrt::Windows::UI::Xaml::Media::CompositionTarget::Rendering(OnRendering);
+        m_isFrameTimerStarted = false;
+    }
+}
+
+void BuildTreeScheduler::UpdateFrameInterval()
+{
+    const double interval = m_frameTimer.PreciseDurationInMilliSeconds();
+    m_frameTimer.Reset();
+    if (!m_isFrameTimerStarted)
+    {
+        // The timer was started on this frame, there is no interval to measure yet.
+        m_isFrameTimerStarted = true;
+        return;
     }
-}
\ No newline at end of file
+
+    // The interval that follows a frame in which we ran work is stretched by that work and the
+    // layout it caused. Sampling it would let the budget feed on itself up to MaxBudgetInMs, so
+    // only the intervals that follow a frame without work are measured.
+    if (interval > 0 && !m_didWorkInLastFrame)
+    {
+        m_frameIntervals[m_frameIntervalCount % s_frameIntervalWindowSize] = interval;
+        ++m_frameIntervalCount;
+
+        // The odd long frame caused by the rest of the app, or short one, should not move
+        // the budget, so use the median of the recent intervals rather than the last one.
+        std::array<double, s_frameIntervalWindowSize> intervals = m_frameIntervals;
+        const auto count = std::min(m_frameIntervalCount, s_frameIntervalWindowSize);
+        const auto median = intervals.begin() + count / 2;
+        std::nth_element(intervals.begin(), median, intervals.begin() + count);
+        m_refreshIntervalInMs = *median;
+    }
+}
+
+void BuildTreeScheduler::TraceFrame(double usedInMs, double budgetInMs)
+{
+    // Buckets are quarters of the budget, the last one counts frames that went over budget.
+    const int bucket = std::min(static_cast<int>(usedInMs * 4 / budgetInMs), static_cast<int>(m_budgetUsageHistogram.size()) - 1);
+    ++m_budgetUsageHistogram[bucket];
+
+    if (IsRepeaterPerfTracingEnabled())
+    {
+        WCHAR buffer[128]{};
+        if (SUCCEEDED(StringCchPrintfW(buffer, ARRAYSIZE(buffer), L"BuildTreeFrame Used:%.1fms Budget:%.1fms Remaining:%d Histogram:%d,%d,%d,%d,%d",
+            usedInMs, budgetInMs, static_cast<int>(m_pendingWork.size()),
+            m_budgetUsageHistogram[0], m_budgetUsageHistogram[1], m_budgetUsageHistogram[2], m_budgetUsageHistogram[3], m_budgetUsageHistogram[4])))
+        {
+            REPEATER_TRACE_PERF(buffer);
+        }
+    }
+}
@@ -5,16 +5,26 @@
 
 struct WorkInfo
 {
-    WorkInfo(int priority, const std::function<void()>& workFunc) :
+    WorkInfo(int priority, int64_t sortKey, uint64_t sequence, const std::function<void()>& workFunc) :
         m_priority(priority),
+        m_sortKey(sortKey),
+        m_sequence(sequence),
         m_workFunc(workFunc)
     {}
 
     int Priority() const { return m_priority; }
     void InvokeWorkFunc() const { m_workFunc(); }
 
+    // Heap ordering: lowest aged priority first, then in registration order.
+    bool RunsAfter(const WorkInfo& other) const
+    {
+        return m_sortKey > other.m_sortKey || (m_sortKey == other.m_sortKey && m_sequence > other.m_sequence);
+    }
+
 private:
     int m_priority;
+    int64_t m_sortKey;
+    uint64_t m_sequence;
     std::function<void()> m_workFunc;
 };
 
@@ -25,13 +35,48 @@ public:
     static void RegisterWork(int priority, const std::function<void()>& workFunc);
     static bool ShouldYield();
 
+    // Upper bound for the time we let the UI thread run between two renders while
+    // there is pending work. The effective budget also scales with the display refresh rate.
+    static double MaxBudgetInMs() { return m_maxBudgetInMs; }
+    static void MaxBudgetInMs(double value);
+    static double BudgetInMs();
+
 private:
     static void OnRendering(const winrt::IInspectable& sender, const winrt::IInspectable& args);
     static void QueueTick();
+    static void UpdateFrameInterval();
+    static void TraceFrame(double usedInMs, double budgetInMs);
 
-    static double m_budgetInMs;
+    static double m_maxBudgetInMs;
+
+    // The budget is this many display frames long. At 60Hz this is the original 40ms budget.
+    static constexpr double s_budgetInFrames = 2.4;
+    // Work waiting for this many frames is treated as one priority level more important,
+    // so that low priority work is not starved by a steady stream of higher priority work.
+    // Priorities are x:Phase values, mostly 0 to 3. During a fling new phase 0 work arrives
+    // every frame; at 4 frames per level it still runs ahead of phase 1 work up to 4 frames
+    // old (about two budgets), while phase 3 work waits at most 12 frames, about 200ms at 60Hz.
+    static constexpr int64_t s_agingFramesPerPriority = 4;
+    // The refresh interval is the median of this many recent frame intervals.
+    static constexpr size_t s_frameIntervalWindowSize = 9;
+    // Frames we stay hooked to Rendering, without work, once the pending work is done. The
+    // second one measures an interval that our work did not stretch.
+    static constexpr int s_idleFramesAfterWork = 2;
 
     static thread_local QPCTimer m_timer;
+    static thread_local QPCTimer m_frameTimer;
+    static thread_local double m_refreshIntervalInMs;
+    // Ring buffer of the last measured frame intervals.
+    static thread_local std::array<double, s_frameIntervalWindowSize> m_frameIntervals;
+    static thread_local size_t m_frameIntervalCount;
+    // The first interval after hooking Rendering starts at QueueTick rather than at a frame, so it is not measured.
+    static thread_local bool m_isFrameTimerStarted;
+    static thread_local bool m_didWorkInLastFrame;
+    static thread_local int m_idleFramesRemaining;
+    static thread_local uint64_t m_frameCount;
+    static thread_local uint64_t m_workSequence;
+    // Binary heap ordered by WorkInfo::RunsAfter.
     static thread_local std::vector<WorkInfo> m_pendingWork;
+    static thread_local std::array<int, 5> m_budgetUsageHistogram;
     static thread_local winrt::event_token m_renderingToken;
-};
\ No newline at end of file
+};
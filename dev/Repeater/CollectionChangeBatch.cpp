@@ -0,0 +1,260 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include <pch.h>
+#include <common.h>
+#include <BindableVector.h>
+#include "ItemsRepeater.common.h"
+#include "CollectionChangeBatch.h"
+
+CollectionChangeBatch::PendingChange::PendingChange(const ITrackerHandleManager* owner, const winrt::NotifyCollectionChangedEventArgs& args) :
+    Action(args.Action()),
+    Index(args.Action() == winrt::NotifyCollectionChangedAction::Remove ? args.OldStartingIndex() : args.NewStartingIndex()),
+    Args(owner, args),
+    NewItems(owner),
+    OldItems(owner)
+{
+}
+
+int CollectionChangeBatch::PendingChange::NewCount() const
+{
+    if (IsMerged())
+    {
+        return NewItems ? static_cast<int>(NewItems.get().Size()) : 0;
+    }
+    return CollectionChangeBatch::NewCount(Args.get());
+}
+
+int CollectionChangeBatch::PendingChange::OldCount() const
+{
+    if (IsMerged())
+    {
+        return OldItems ? static_cast<int>(OldItems.get().Size()) : 0;
+    }
+    return CollectionChangeBatch::OldCount(Args.get());
+}
+
+/*static*/
+bool CollectionChangeBatch::CanBuffer(winrt::NotifyCollectionChangedAction action)
+{
+    // Reset and Move are rare and do not benefit from merging. The owner
+    // flushes the batch and processes them right away.
+    return action == winrt::NotifyCollectionChangedAction::Add ||
+        action == winrt::NotifyCollectionChangedAction::Remove ||
+        action == winrt::NotifyCollectionChangedAction::Replace;
+}
+
+void CollectionChangeBatch::Add(const winrt::NotifyCollectionChangedEventArgs& args)
+{
+    MUX_ASSERT(CanBuffer(args.Action()));
+    ++m_receivedCount;
+
+    if (m_changes.empty() || !TryMerge(m_changes.back(), args))
+    {
+        m_changes.emplace_back(m_owner, args);
+    }
+}
+
+void CollectionChangeBatch::Clear()
+{
+    m_changes.clear();
+    m_receivedCount = 0;
+}
+
+std::vector<winrt::NotifyCollectionChangedEventArgs> CollectionChangeBatch::TakeChanges()
+{
+    std::vector<winrt::NotifyCollectionChangedEventArgs> result;
+    result.reserve(m_changes.size());
+
+    for (const auto& change : m_changes)
+    {
+        if (!change.IsMerged())
+        {
+            result.push_back(change.Args.get());
+        }
+        else
+        {
+            const bool hasNew = change.Action != winrt::NotifyCollectionChangedAction::Remove;
+            const bool hasOld = change.Action != winrt::NotifyCollectionChangedAction::Add;
+            result.push_back(
+                winrt::NotifyCollectionChangedEventArgs(
+                    change.Action,
+                    hasNew ? change.NewItems.get() : nullptr,
+                    hasOld ? change.OldItems.get() : nullptr,
+                    hasNew ? change.Index : -1 /* newIndex */,
+                    hasOld ? change.Index : -1 /* oldIndex */));
+        }
+    }
+
+    Clear();
+    return result;
+}
+
+bool CollectionChangeBatch::TryMerge(PendingChange& last, const winrt::NotifyCollectionChangedEventArgs& args)
+{
+    const auto action = args.Action();
+
+    if (last.Action == winrt::NotifyCollectionChangedAction::Add)
+    {
+        const int lastCount = last.NewCount();
+
+        if (action == winrt::NotifyCollectionChangedAction::Add)
+        {
+            // Insert inside or right at either end of the run that was just inserted.
+            const int index = args.NewStartingIndex();
+            if (index >= last.Index && index <= last.Index + lastCount)
+            {
+                EnsureMerged(last);
+                InsertItems(last.NewItems.get(), index - last.Index, args.NewItems(), 0, NewCount(args));
+                return true;
+            }
+        }
+        else if (action == winrt::NotifyCollectionChangedAction::Remove)
+        {
+            // Removing items that were just inserted cancels the insert out.
+            const int index = args.OldStartingIndex();
+            const int count = OldCount(args);
+            if (index >= last.Index && index + count <= last.Index + lastCount)
+            {
+                if (count == lastCount)
+                {
+                    m_changes.pop_back();
+                }
+                else
+                {
+                    EnsureMerged(last);
+                    auto items = last.NewItems.get();
+                    for (int i = 0; i < count; ++i)
+                    {
+                        items.RemoveAt(static_cast<uint32_t>(index - last.Index));
+                    }
+                }
+                return true;
+            }
+        }
+        else if (action == winrt::NotifyCollectionChangedAction::Replace)
+        {
+            // Replacing items that were just inserted is still an insert.
+            const int index = args.NewStartingIndex();
+            const int count = NewCount(args);
+            if (index == args.OldStartingIndex() &&
+                count == OldCount(args) &&
+                index >= last.Index && index + count <= last.Index + lastCount)
+            {
+                EnsureMerged(last);
+                auto items = last.NewItems.get();
+                auto newItems = args.NewItems();
+                for (int i = 0; i < count; ++i)
+                {
+                    items.SetAt(static_cast<uint32_t>(index - last.Index + i), newItems.GetAt(static_cast<uint32_t>(i)));
+                }
+                return true;
+            }
+        }
+    }
+    else if (last.Action == winrt::NotifyCollectionChangedAction::Remove &&
+        action == winrt::NotifyCollectionChangedAction::Remove)
+    {
+        // The new range, expressed after the previous removal, touches the position
+        // where the previous run used to be. In terms of the original collection the
+        // two ranges form one contiguous range starting at the new index.
+        const int index = args.OldStartingIndex();
+        const int count = OldCount(args);
+        if (last.Index >= index && last.Index <= index + count)
+        {
+            EnsureMerged(last);
+            const int countBefore = last.Index - index;
+            auto oldItems = args.OldItems();
+            InsertItems(last.OldItems.get(), 0, oldItems, 0, countBefore);
+            InsertItems(last.OldItems.get(), static_cast<int>(last.OldItems.get().Size()), oldItems, countBefore, count - countBefore);
+            last.Index = index;
+            return true;
+        }
+    }
+    else if (last.Action == winrt::NotifyCollectionChangedAction::Replace &&
+        action == winrt::NotifyCollectionChangedAction::Replace)
+    {
+        // Only one for one replacements are merged, longer or shorter replacements
+        // shift indices and are left alone.
+        const int index = args.NewStartingIndex();
+        const int count = NewCount(args);
+        const int lastCount = last.NewCount();
+        if (index == args.OldStartingIndex() &&
+            count == OldCount(args) &&
+            lastCount == last.OldCount())
+        {
+            if (index == last.Index + lastCount)
+            {
+                EnsureMerged(last);
+                InsertItems(last.NewItems.get(), lastCount, args.NewItems(), 0, count);
+                InsertItems(last.OldItems.get(), lastCount, args.OldItems(), 0, count);
+                return true;
+            }
+            else if (index == last.Index && count == lastCount)
+            {
+                // The same range was replaced again. The old items stay the ones from
+                // before the first replacement.
+                EnsureMerged(last);
+                last.NewItems.set(CopyItems(args.NewItems()));
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void CollectionChangeBatch::EnsureMerged(PendingChange& change)
+{
+    if (!change.IsMerged())
+    {
+        auto args = change.Args.get();
+        change.NewItems.set(CopyItems(args.NewItems()));
+        change.OldItems.set(CopyItems(args.OldItems()));
+        change.Args.set(nullptr);
+    }
+}
+
+/*static*/
+int CollectionChangeBatch::NewCount(const winrt::NotifyCollectionChangedEventArgs& args)
+{
+    auto items = args.NewItems();
+    return items ? static_cast<int>(items.Size()) : 0;
+}
+
+/*static*/
+int CollectionChangeBatch::OldCount(const winrt::NotifyCollectionChangedEventArgs& args)
+{
+    auto items = args.OldItems();
+    return items ? static_cast<int>(items.Size()) : 0;
+}
+
+/*static*/
+void CollectionChangeBatch::InsertItems(const winrt::IBindableVector& target, int targetIndex, const winrt::IBindableVector& source, int sourceStart, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        // Sources without items still report the count through their size, in which case
+        // we only need placeholders.
+        auto item = source ? source.GetAt(static_cast<uint32_t>(sourceStart + i)) : nullptr;
+        if (targetIndex + i == static_cast<int>(target.Size()))
+        {
+            target.Append(item);
+        }
+        else
+        {
+            target.InsertAt(static_cast<uint32_t>(targetIndex + i), item);
+        }
+    }
+}
+
+/*static*/
+winrt::IBindableVector CollectionChangeBatch::CopyItems(const winrt::IBindableVector& source)
+{
+    winrt::IBindableVector result = winrt::make<Vector<winrt::IInspectable, MakeVectorParam<VectorFlag::Bindable>()>>();
+    if (source)
+    {
+        InsertItems(result, 0, source, 0, static_cast<int>(source.Size()));
+    }
+    return result;
+}
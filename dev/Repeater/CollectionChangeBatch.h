@@ -0,0 +1,63 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Buffers Add, Remove and Replace notifications coming from an ItemsSourceView so that
+// ItemsRepeater can process a burst of changes in one go right before the next measure.
+// A change that extends the run of the previous buffered change (for example, inserting
+// right after the items that were just inserted) is folded into it, so a loop of N
+// single item inserts reaches the layout and the view manager as one insert of N items.
+// Changes are only ever merged with the last buffered change, which keeps the net effect
+// of replaying the buffer identical to replaying the original notifications.
+class CollectionChangeBatch final
+{
+public:
+    CollectionChangeBatch(const ITrackerHandleManager* owner) : m_owner(owner) { }
+
+    static bool CanBuffer(winrt::NotifyCollectionChangedAction action);
+
+    bool IsEmpty() const { return m_changes.empty(); }
+    int ReceivedCount() const { return m_receivedCount; }
+
+    void Add(const winrt::NotifyCollectionChangedEventArgs& args);
+    void Clear();
+
+    // Returns the buffered changes in the order they need to be processed
+    // and leaves the batch empty.
+    std::vector<winrt::NotifyCollectionChangedEventArgs> TakeChanges();
+
+    // we do not want copies of this type
+    CollectionChangeBatch(const CollectionChangeBatch& that) = delete;
+    CollectionChangeBatch& operator=(const CollectionChangeBatch& other) = delete;
+
+private:
+    struct PendingChange
+    {
+        PendingChange(const ITrackerHandleManager* owner, const winrt::NotifyCollectionChangedEventArgs& args);
+
+        winrt::NotifyCollectionChangedAction Action{};
+        int Index{ -1 };
+        // The original notification. Only used when nothing was merged into it.
+        tracker_ref<winrt::NotifyCollectionChangedEventArgs> Args;
+        // Items of the merged run. Populated the first time another change gets merged in.
+        tracker_ref<winrt::IBindableVector> NewItems;
+        tracker_ref<winrt::IBindableVector> OldItems;
+
+        bool IsMerged() const { return !Args; }
+        int NewCount() const;
+        int OldCount() const;
+    };
+
+    bool TryMerge(PendingChange& last, const winrt::NotifyCollectionChangedEventArgs& args);
+    void EnsureMerged(PendingChange& change);
+
+    static int NewCount(const winrt::NotifyCollectionChangedEventArgs& args);
+    static int OldCount(const winrt::NotifyCollectionChangedEventArgs& args);
+    static void InsertItems(const winrt::IBindableVector& target, int targetIndex, const winrt::IBindableVector& source, int sourceStart, int count);
+    static winrt::IBindableVector CopyItems(const winrt::IBindableVector& source);
+
+    const ITrackerHandleManager* m_owner;
+    std::vector<PendingChange> m_changes;
+    int m_receivedCount{};
+};
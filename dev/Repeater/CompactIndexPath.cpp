@@ -0,0 +1,161 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "CompactIndexPath.h"
+
+CompactIndexPath::CompactIndexPath(int index)
+{
+    m_inline[0] = index;
+    m_size = 1;
+}
+
+CompactIndexPath::CompactIndexPath(int groupIndex, int itemIndex)
+{
+    m_inline[0] = groupIndex;
+    m_inline[1] = itemIndex;
+    m_size = 2;
+}
+
+CompactIndexPath::CompactIndexPath(const int* indices, int count)
+{
+    Reserve(count);
+    if (count > 0)
+    {
+        std::copy(indices, indices + count, MutableData());
+    }
+
+    m_size = count;
+}
+
+CompactIndexPath::CompactIndexPath(const CompactIndexPath& other)
+    : CompactIndexPath(other.Data(), other.m_size)
+{
+}
+
+CompactIndexPath::CompactIndexPath(CompactIndexPath&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+CompactIndexPath& CompactIndexPath::operator=(const CompactIndexPath& other)
+{
+    if (this != &other)
+    {
+        m_size = 0;
+        Reserve(other.m_size);
+        std::copy(other.Data(), other.Data() + other.m_size, MutableData());
+        m_size = other.m_size;
+    }
+
+    return *this;
+}
+
+CompactIndexPath& CompactIndexPath::operator=(CompactIndexPath&& other) noexcept
+{
+    if (this != &other)
+    {
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+        m_heap = std::move(other.m_heap);
+        if (!m_heap)
+        {
+            std::copy(other.m_inline, other.m_inline + m_size, m_inline);
+        }
+
+        other.m_size = 0;
+        other.m_capacity = s_inlineCapacity;
+    }
+
+    return *this;
+}
+
+int CompactIndexPath::At(int depth) const
+{
+    if (depth < 0 || depth >= m_size)
+    {
+        throw std::out_of_range("depth");
+    }
+
+    return Data()[depth];
+}
+
+void CompactIndexPath::Append(int index)
+{
+    if (m_size == m_capacity)
+    {
+        Reserve(m_capacity * 2);
+    }
+
+    MutableData()[m_size++] = index;
+}
+
+void CompactIndexPath::Truncate(int size)
+{
+    MUX_ASSERT(size >= 0 && size <= m_size);
+    m_size = size;
+}
+
+CompactIndexPath CompactIndexPath::CloneWithChildIndex(int childIndex) const
+{
+    CompactIndexPath clone;
+    clone.Reserve(m_size + 1);
+    std::copy(Data(), Data() + m_size, clone.MutableData());
+    clone.MutableData()[m_size] = childIndex;
+    clone.m_size = m_size + 1;
+    return clone;
+}
+
+int CompactIndexPath::CompareTo(const CompactIndexPath& rhs) const
+{
+    const int commonSize = std::min(m_size, rhs.m_size);
+    const int* lhsData = Data();
+    const int* rhsData = rhs.Data();
+
+    // Find the first differing level with a single linear scan over the contiguous storage
+    // rather than fetching one level at a time.
+    const auto mismatch = std::mismatch(lhsData, lhsData + commonSize, rhsData);
+    if (mismatch.first != lhsData + commonSize)
+    {
+        return *mismatch.first < *mismatch.second ? -1 : 1;
+    }
+
+    // Equal up to the shorter path, the shorter one sorts first.
+    return m_size == rhs.m_size ? 0 : (m_size < rhs.m_size ? -1 : 1);
+}
+
+bool CompactIndexPath::StartsWith(const CompactIndexPath& prefix) const
+{
+    return prefix.m_size <= m_size &&
+        std::memcmp(Data(), prefix.Data(), prefix.m_size * sizeof(int)) == 0;
+}
+
+size_t CompactIndexPath::Hash() const
+{
+    // FNV-1a over the levels, seeded with the depth so that prefixes hash apart.
+    size_t hash = static_cast<size_t>(14695981039346656037ull) ^ static_cast<size_t>(m_size);
+    const int* data = Data();
+    for (int i = 0; i < m_size; i++)
+    {
+        hash = (hash ^ static_cast<size_t>(static_cast<unsigned int>(data[i]))) * static_cast<size_t>(1099511628211ull);
+    }
+
+    return hash;
+}
+
+bool CompactIndexPath::operator==(const CompactIndexPath& rhs) const
+{
+    return m_size == rhs.m_size &&
+        std::memcmp(Data(), rhs.Data(), m_size * sizeof(int)) == 0;
+}
+
+void CompactIndexPath::Reserve(int capacity)
+{
+    if (capacity > m_capacity)
+    {
+        auto heap = std::make_unique<int[]>(capacity);
+        std::copy(Data(), Data() + m_size, heap.get());
+        m_heap = std::move(heap);
+        m_capacity = capacity;
+    }
+}
@@ -0,0 +1,67 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Value type backing IndexPath and used directly by the selection tree walks. Paths of up to
+// s_inlineCapacity levels (every flat and grouped list) live in the object itself, so copying
+// or extending one does not touch the heap; deeper paths spill into a heap block.
+class CompactIndexPath final
+{
+public:
+    static constexpr int s_inlineCapacity = 4;
+
+    CompactIndexPath() = default;
+    explicit CompactIndexPath(int index);
+    CompactIndexPath(int groupIndex, int itemIndex);
+    CompactIndexPath(const int* indices, int count);
+
+    CompactIndexPath(const CompactIndexPath& other);
+    CompactIndexPath(CompactIndexPath&& other) noexcept;
+    CompactIndexPath& operator=(const CompactIndexPath& other);
+    CompactIndexPath& operator=(CompactIndexPath&& other) noexcept;
+
+    int Size() const { return m_size; }
+    bool IsEmpty() const { return m_size == 0; }
+    const int* Data() const { return m_heap ? m_heap.get() : m_inline; }
+    int operator[](int depth) const { return Data()[depth]; }
+    // Bounds checked version of operator[]; throws std::out_of_range like std::vector::at.
+    int At(int depth) const;
+    int Back() const { return Data()[m_size - 1]; }
+
+    void Append(int index);
+    void Truncate(int size);
+    CompactIndexPath CloneWithChildIndex(int childIndex) const;
+
+    // Returns -1, 0 or 1. Paths are ordered lexicographically; a path sorts before any path
+    // it is a prefix of.
+    int CompareTo(const CompactIndexPath& rhs) const;
+    // True if the first prefix.Size() levels of this path are equal to prefix.
+    bool StartsWith(const CompactIndexPath& prefix) const;
+    size_t Hash() const;
+
+    bool operator==(const CompactIndexPath& rhs) const;
+    bool operator!=(const CompactIndexPath& rhs) const { return !(*this == rhs); }
+    bool operator<(const CompactIndexPath& rhs) const { return CompareTo(rhs) < 0; }
+
+private:
+    int* MutableData() { return m_heap ? m_heap.get() : m_inline; }
+    void Reserve(int capacity);
+
+    int m_size{ 0 };
+    int m_capacity{ s_inlineCapacity };
+    int m_inline[s_inlineCapacity]{};
+    std::unique_ptr<int[]> m_heap;
+};
+
+namespace std
+{
+    template<>
+    struct hash<CompactIndexPath>
+    {
+        size_t operator()(const CompactIndexPath& path) const
+        {
+            return path.Hash();
+        }
+    };
+}
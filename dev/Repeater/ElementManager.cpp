@@ -30,12 +30,12 @@ void ElementManager::OnBeginMeasure(const ScrollOrientation& orientation)
             // If we are initialized with a non-virtualizing context, make sure that
             // we have enough space to hold the bounds for all the elements.
             int count = m_context.ItemCount();
-            if (static_cast<int>(m_realizedElementLayoutBounds.size()) != count)
+            if (m_realizedElements.Size() != count)
             {
                 // Make sure there is enough space for the bounds.
                 // Note: We could optimize when the count becomes smaller, but keeping
                 // it always up to date is the simplest option for now.
-                m_realizedElementLayoutBounds.resize(count, winrt::Rect());
+                m_realizedElements.Resize(count);
             }
         }
     }
@@ -44,7 +44,7 @@ void ElementManager::OnBeginMeasure(const ScrollOrientation& orientation)
 int ElementManager::GetRealizedElementCount() const
 {
     return IsVirtualizingContext() ?
-        static_cast<int>(m_realizedElements.size()) : m_context.ItemCount();
+        m_realizedElements.Size() : m_context.ItemCount();
 }
 
 winrt::UIElement ElementManager::GetAt(int realizedIndex)
@@ -52,17 +52,14 @@ winrt::UIElement ElementManager::GetAt(int realizedIndex)
     winrt::UIElement element{ nullptr };
     if (IsVirtualizingContext())
     {
-        if (!m_realizedElements[realizedIndex])
+        element = m_realizedElements.GetElement(realizedIndex);
+        if (!element)
         {
             // Sentinel. Create the element now since we need it.
             int dataIndex = GetDataIndexFromRealizedRangeIndex(realizedIndex);
             REPEATER_TRACE_INFO(L"Creating element for sentinal with data index %d. \n", dataIndex);
             element = m_context.GetOrCreateElementAt(dataIndex, winrt::ElementRealizationOptions::ForceCreate | winrt::ElementRealizationOptions::SuppressAutoRecycle);
-            m_realizedElements[realizedIndex] = tracker_ref<winrt::UIElement>{ m_owner, element };
-        }
-        else
-        {
-            element = m_realizedElements[realizedIndex].get();
+            m_realizedElements.SetElement(realizedIndex, element);
         }
     }
     else
@@ -78,13 +75,12 @@ void ElementManager::Add(const winrt::UIElement& element, int dataIndex)
 {
     MUX_ASSERT(IsVirtualizingContext());
 
-    if (m_realizedElements.size() == 0)
+    if (m_realizedElements.Size() == 0)
     {
         m_firstRealizedDataIndex = dataIndex;
     }
 
-    m_realizedElements.emplace_back(tracker_ref<winrt::UIElement>{ m_owner, element });
-    m_realizedElementLayoutBounds.emplace_back(winrt::Rect());
+    m_realizedElements.PushBack(element, winrt::Rect());
 }
 
 void ElementManager::Insert(int realizedIndex, int dataIndex, const winrt::UIElement& element)
@@ -95,9 +91,8 @@ void ElementManager::Insert(int realizedIndex, int dataIndex, const winrt::UIEle
         m_firstRealizedDataIndex = dataIndex;
     }
 
-    m_realizedElements.insert(m_realizedElements.begin() + realizedIndex, tracker_ref<winrt::UIElement>{ m_owner, element });
     // Set bounds to an invalid rect since we do not know it yet.
-    m_realizedElementLayoutBounds.insert(m_realizedElementLayoutBounds.begin() + realizedIndex, winrt::Rect{ -1.f, -1.f, -1.f, -1.f });
+    m_realizedElements.Insert(realizedIndex, element, winrt::Rect{ -1.f, -1.f, -1.f, -1.f });
 }
 
 void ElementManager::ClearRealizedRange(int realizedIndex, int count)
@@ -108,20 +103,18 @@ void ElementManager::ClearRealizedRange(int realizedIndex, int count)
         // Clear from the edges so that ItemsRepeater can optimize on maintaining 
         // realized indices without walking through all the children every time.
         int index = realizedIndex == 0 ? realizedIndex + i : (realizedIndex + count - 1) - i;
-        if (auto elementRef = m_realizedElements[index])
+        if (auto element = m_realizedElements.GetElement(index))
         {
-            m_context.RecycleElement(elementRef.get());
+            m_context.RecycleElement(element);
         }
     }
 
-    int endIndex = realizedIndex + count;
-    m_realizedElements.erase(m_realizedElements.begin() + realizedIndex, m_realizedElements.begin() + endIndex);
-    m_realizedElementLayoutBounds.erase(m_realizedElementLayoutBounds.begin() + realizedIndex, m_realizedElementLayoutBounds.begin() + endIndex);
+    m_realizedElements.Erase(realizedIndex, count);
 
     if (realizedIndex == 0)
     {
         m_firstRealizedDataIndex =
-            m_realizedElements.size() == 0 ?
+            m_realizedElements.Size() == 0 ?
             -1 :
             m_firstRealizedDataIndex + count;
     }
@@ -156,24 +149,24 @@ void ElementManager::ClearRealizedRange()
 winrt::Rect ElementManager::GetLayoutBoundsForDataIndex(int dataIndex) const
 {
     int realizedIndex = GetRealizedRangeIndexFromDataIndex(dataIndex);
-    return m_realizedElementLayoutBounds[realizedIndex];
+    return m_realizedElements.GetBounds(realizedIndex);
 }
 
 void ElementManager::SetLayoutBoundsForDataIndex(int dataIndex, const winrt::Rect& bounds)
 {
     int realizedIndex = GetRealizedRangeIndexFromDataIndex(dataIndex);
-    m_realizedElementLayoutBounds[realizedIndex] = bounds;
+    m_realizedElements.SetBounds(realizedIndex, bounds);
 }
 
 
 winrt::Rect ElementManager::GetLayoutBoundsForRealizedIndex(int realizedIndex) const
 {
-    return m_realizedElementLayoutBounds[realizedIndex];
+    return m_realizedElements.GetBounds(realizedIndex);
 }
 
 void ElementManager::SetLayoutBoundsForRealizedIndex(int realizedIndex, const winrt::Rect& bounds)
 {
-    m_realizedElementLayoutBounds[realizedIndex] = bounds;
+    m_realizedElements.SetBounds(realizedIndex, bounds);
 }
 
 
@@ -232,7 +225,7 @@ bool ElementManager::IsWindowConnected(const winrt::Rect& window, const ScrollOr
 {
     MUX_ASSERT(IsVirtualizingContext());
     bool intersects = false;
-    if (m_realizedElementLayoutBounds.size() > 0)
+    if (m_realizedElements.Size() > 0)
     {
         auto firstElementBounds = GetLayoutBoundsForRealizedIndex(0);
         auto lastElementBounds = GetLayoutBoundsForRealizedIndex(GetRealizedElementCount() - 1);
@@ -258,7 +251,7 @@ bool ElementManager::IsWindowConnected(const winrt::Rect& window, const ScrollOr
 void ElementManager::DataSourceChanged(const winrt::IInspectable& /*source*/, winrt::NotifyCollectionChangedEventArgs const& args)
 {
     MUX_ASSERT(IsVirtualizingContext());
-    if (m_realizedElements.size() > 0)
+    if (m_realizedElements.Size() > 0)
     {
         switch (args.Action())
         {
@@ -295,10 +288,10 @@ void ElementManager::DataSourceChanged(const winrt::IInspectable& /*source*/, wi
 int ElementManager::GetElementDataIndex(const winrt::UIElement& suggestedAnchor) const
 {
     MUX_ASSERT(suggestedAnchor);
-    auto it = std::find(m_realizedElements.cbegin(), m_realizedElements.cend(), suggestedAnchor);
+    const int realizedIndex = m_realizedElements.IndexOf(suggestedAnchor);
     return
-        it != m_realizedElements.cend() ?
-        GetDataIndexFromRealizedRangeIndex(static_cast<int>(std::distance(m_realizedElements.cbegin(), it))) :
+        realizedIndex != -1 ?
+        GetDataIndexFromRealizedRangeIndex(realizedIndex) :
         -1;
 }
 
@@ -319,7 +312,6 @@ int ElementManager::GetRealizedRangeIndexFromDataIndex(int dataIndex) const
 void ElementManager::DiscardElementsOutsideWindow(const winrt::Rect& window, const ScrollOrientation& orientation)
 {
     MUX_ASSERT(IsVirtualizingContext());
-    MUX_ASSERT(m_realizedElements.size() == m_realizedElementLayoutBounds.size());
 
     // The following illustration explains the cutoff indices.
     // We will clear all the realized elements from both ends
@@ -344,24 +336,10 @@ void ElementManager::DiscardElementsOutsideWindow(const winrt::Rect& window, con
     // layout pass).
 
     const int realizedRangeSize = GetRealizedElementCount();
-    int frontCutoffIndex = -1;
-    int backCutoffIndex = realizedRangeSize;
-
-    for (int i = 0;
-        i < realizedRangeSize &&
-        !Intersects(window, m_realizedElementLayoutBounds[i], orientation);
-        ++i)
-    {
-        ++frontCutoffIndex;
-    }
-
-    for (int i = realizedRangeSize - 1;
-        i >= 0 &&
-        !Intersects(window, m_realizedElementLayoutBounds[i], orientation);
-        --i)
-    {
-        --backCutoffIndex;
-    }
+    const float windowStart = orientation == ScrollOrientation::Vertical ? window.Y : window.X;
+    const float windowEnd = windowStart + (orientation == ScrollOrientation::Vertical ? window.Height : window.Width);
+    const int frontCutoffIndex = m_realizedElements.CountOutsideFromFront(windowStart, windowEnd, orientation) - 1;
+    const int backCutoffIndex = realizedRangeSize - m_realizedElements.CountOutsideFromBack(windowStart, windowEnd, orientation);
 
     if (backCutoffIndex < realizedRangeSize - 1)
     {
@@ -374,17 +352,6 @@ void ElementManager::DiscardElementsOutsideWindow(const winrt::Rect& window, con
     }
 }
 
-/* static */
-bool ElementManager::Intersects(const winrt::Rect& lhs, const winrt::Rect& rhs, const ScrollOrientation& orientation)
-{
-    auto lhsStart = orientation == ScrollOrientation::Vertical ? lhs.Y : lhs.X;
-    auto lhsEnd = orientation == ScrollOrientation::Vertical ? lhs.Y + lhs.Height : lhs.X + lhs.Width;
-    auto rhsStart = orientation == ScrollOrientation::Vertical ? rhs.Y : rhs.X;
-    auto rhsEnd = orientation == ScrollOrientation::Vertical ? rhs.Y + rhs.Height : rhs.X + rhs.Width;
-
-    return lhsEnd >= rhsStart && lhsStart <= rhsEnd;
-}
-
 void ElementManager::OnItemsAdded(int index, int count)
 {
     // Using the old indices here (before it was updated by the collection change)
@@ -417,7 +384,7 @@ void ElementManager::OnItemsAdded(int index, int count)
 
 void ElementManager::OnItemsRemoved(int index, int count)
 {
-    const int lastRealizedDataIndex = m_firstRealizedDataIndex + static_cast<int>(m_realizedElements.size()) - 1;
+    const int lastRealizedDataIndex = m_firstRealizedDataIndex + m_realizedElements.Size() - 1;
     const int startIndex = std::max(m_firstRealizedDataIndex, index);
     const int endIndex = std::min(lastRealizedDataIndex, index + count - 1);
     const bool removeAffectsFirstRealizedDataIndex = (index <= m_firstRealizedDataIndex);
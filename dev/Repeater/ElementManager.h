@@ -4,6 +4,7 @@
 #pragma once
 
 #include "OrientationBasedMeasures.h"
+#include "RealizedElementStore.h"
 
 // Internal component for layout to keep track of elements and
 // help with collection changes.
@@ -11,7 +12,7 @@ class ElementManager final
 {
 
 public:
-    ElementManager(const ITrackerHandleManager* owner) : m_owner(owner) { }
+    ElementManager(const ITrackerHandleManager* owner) : m_owner(owner), m_realizedElements(owner) { }
 
     void SetContext(const winrt::VirtualizingLayoutContext& virtualContext);
     
@@ -52,7 +53,6 @@ private:
     int GetRealizedRangeIndexFromDataIndex(int dataIndex) const;
 
     void DiscardElementsOutsideWindow(const winrt::Rect& window, const ScrollOrientation& orientation);
-    static bool Intersects(const winrt::Rect& lhs, const winrt::Rect& rhs, const ScrollOrientation& orientation);
 
     void OnItemsAdded(int index, int count);
     void OnItemsRemoved(int index, int count);
@@ -61,8 +61,9 @@ private:
 
     const ITrackerHandleManager* m_owner;
 
-    std::vector<tracker_ref<winrt::UIElement>> m_realizedElements;
-    std::vector<winrt::Rect> m_realizedElementLayoutBounds;
+    // Realized elements and their layout bounds. For non-virtualizing contexts
+    // this only holds the bounds of every item and no elements.
+    RealizedElementStore m_realizedElements;
     int m_firstRealizedDataIndex{ -1 };
     winrt::VirtualizingLayoutContext m_context{ nullptr };
 };
@@ -78,6 +78,166 @@ winrt::Size FlowLayoutAlgorithm::Measure(
     return winrt::Size{ m_lastExtent.Width, m_lastExtent.Height };
 }
 
+winrt::Size FlowLayoutAlgorithm::MeasureUniform(
+    const winrt::Size& availableSize,
+    const winrt::VirtualizingLayoutContext& context,
+    const winrt::Size& itemSize,
+    double minItemSpacing,
+    double lineSpacing,
+    const ScrollOrientation& orientation,
+    const wstring_view& layoutId)
+{
+    SetScrollOrientation(orientation);
+
+    const int itemsCount = context.ItemCount();
+    const auto realizationRect = RealizationRect();
+    const float availableSizeMinor = availableSize.*Minor();
+    const float itemMinorSizeWithSpacing = itemSize.*Minor() + static_cast<float>(minItemSpacing);
+    const float lineSizeWithSpacing = itemSize.*Major() + static_cast<float>(lineSpacing);
+    const auto uniformInfo = GetUniformLayoutInfo(itemsCount, availableSizeMinor, itemSize.*Minor(), itemSize.*Major(), minItemSpacing, lineSpacing);
+
+    // When the suggested anchor is not realized yet (for example it was requested through
+    // GetOrCreateElement) the regular path makes it the anchor, so we let it handle that case.
+    // The same goes for non-virtualizing hosts and for the case where all the items are in a single line.
+    const int suggestedAnchorIndex = context.RecommendedAnchorIndex();
+    const bool isSuggestedAnchorValid = m_elementManager.IsIndexValidInData(suggestedAnchorIndex);
+    const bool canUseClosedForm =
+        IsVirtualizingContext() &&
+        itemsCount > 0 &&
+        std::isfinite(availableSizeMinor) &&
+        realizationRect.*MajorSize() > 0 &&
+        itemMinorSizeWithSpacing > 0 &&
+        lineSizeWithSpacing > 0 &&
+        (!isSuggestedAnchorValid || m_elementManager.IsDataIndexRealized(suggestedAnchorIndex));
+
+    int firstIndex = -1;
+    int lastIndex = -1;
+    const int itemsPerLine = uniformInfo.ItemsPerLine;
+    const int lineCount = uniformInfo.LineCount;
+    const float origin = m_lastExtent.*MajorStart();
+    if (canUseClosedForm)
+    {
+        const int firstLine = std::max(0, static_cast<int>(std::floor((realizationRect.*MajorStart() - origin) / lineSizeWithSpacing)));
+        const int lastLine = std::min(lineCount - 1, static_cast<int>(std::floor((MajorEnd(realizationRect) - origin) / lineSizeWithSpacing)));
+        // The suggested anchor has to stay realized so that scroll anchoring keeps working. Stretching the
+        // range out to an anchor outside of the realization window would realize every item in between, so
+        // the regular path handles that case instead.
+        const int suggestedAnchorLine = isSuggestedAnchorValid ? suggestedAnchorIndex / itemsPerLine : firstLine;
+        if (firstLine <= lastLine && suggestedAnchorLine >= firstLine && suggestedAnchorLine <= lastLine)
+        {
+            firstIndex = firstLine * itemsPerLine;
+            lastIndex = std::min(itemsCount - 1, (lastLine + 1) * itemsPerLine - 1);
+        }
+    }
+
+    if (firstIndex == -1)
+    {
+        return Measure(availableSize, context, true /* isWrapping */, minItemSpacing, lineSpacing, orientation, layoutId);
+    }
+
+    REPEATER_TRACE_INFO(L"%*s: \tMeasureLayout Uniform items %d to %d with %d items per line\n",
+        winrt::get_self<VirtualizingLayoutContext>(context)->Indent(),
+        layoutId.data(),
+        firstIndex, lastIndex, itemsPerLine);
+
+    // Let go of the elements outside of the new range.
+    int realizedCount = m_elementManager.GetRealizedElementCount();
+    if (realizedCount > 0)
+    {
+        const int firstRealizedIndex = m_elementManager.GetDataIndexFromRealizedRangeIndex(0);
+        const int lastRealizedIndex = m_elementManager.GetDataIndexFromRealizedRangeIndex(realizedCount - 1);
+        if (lastRealizedIndex < firstIndex || firstRealizedIndex > lastIndex)
+        {
+            m_elementManager.ClearRealizedRange();
+        }
+        else
+        {
+            m_elementManager.DiscardElementsOutsideWindow(true /* forward */, lastIndex + 1);
+            m_elementManager.DiscardElementsOutsideWindow(false /* forward */, firstIndex - 1);
+        }
+    }
+
+    // Realize whatever is missing on either end of what we kept.
+    realizedCount = m_elementManager.GetRealizedElementCount();
+    const int keptFirstIndex = realizedCount > 0 ? m_elementManager.GetDataIndexFromRealizedRangeIndex(0) : firstIndex;
+    for (int dataIndex = keptFirstIndex - 1; dataIndex >= firstIndex; --dataIndex)
+    {
+        m_elementManager.EnsureElementRealized(false /* forward */, dataIndex, layoutId);
+    }
+
+    for (int dataIndex = keptFirstIndex; dataIndex <= lastIndex; ++dataIndex)
+    {
+        m_elementManager.EnsureElementRealized(true /* forward */, dataIndex, layoutId);
+    }
+
+    MUX_ASSERT(m_elementManager.GetRealizedElementCount() == lastIndex - firstIndex + 1);
+    for (int dataIndex = firstIndex; dataIndex <= lastIndex; ++dataIndex)
+    {
+        const int realizedIndex = dataIndex - firstIndex;
+        m_elementManager.GetAt(realizedIndex).Measure(itemSize);
+
+        const int line = dataIndex / itemsPerLine;
+        const int indexInLine = dataIndex - line * itemsPerLine;
+        m_elementManager.SetLayoutBoundsForRealizedIndex(
+            realizedIndex,
+            MinorMajorRect(
+                indexInLine * itemMinorSizeWithSpacing,
+                origin + line * lineSizeWithSpacing,
+                itemSize.*Minor(),
+                itemSize.*Major()));
+    }
+
+    m_firstRealizedDataIndexInsideRealizationWindow = firstIndex;
+    m_lastRealizedDataIndexInsideRealizationWindow = lastIndex;
+    m_scrollOrientationSameAsFlow = false;
+    m_collectionChangePending = false;
+    m_lastAvailableSize = availableSize;
+    m_lastItemSpacing = minItemSpacing;
+
+    m_lastExtent = MinorMajorRect(0, origin, uniformInfo.ExtentMinorSize, uniformInfo.ExtentMajorSize);
+    SetLayoutOrigin();
+
+    return winrt::Size{ m_lastExtent.Width, m_lastExtent.Height };
+}
+
+/* static */
+FlowLayoutAlgorithm::UniformLayoutInfo FlowLayoutAlgorithm::GetUniformLayoutInfo(
+    int itemsCount,
+    float availableSizeMinor,
+    float itemMinorSize,
+    float itemMajorSize,
+    double minItemSpacing,
+    double lineSpacing)
+{
+    const float itemMinorSizeWithSpacing = itemMinorSize + static_cast<float>(minItemSpacing);
+    const float lineSizeWithSpacing = itemMajorSize + static_cast<float>(lineSpacing);
+
+    UniformLayoutInfo info{ 1, 0, 0.0f, 0.0f };
+    if (itemsCount <= 0)
+    {
+        return info;
+    }
+
+    if (std::isfinite(availableSizeMinor) && itemMinorSizeWithSpacing > 0)
+    {
+        // Same rule as Generate: an item stays in the current line as long as it ends within
+        // the available size, so the last item of a line does not need room for its spacing.
+        const double itemsThatFit = (availableSizeMinor + minItemSpacing) / itemMinorSizeWithSpacing;
+        info.ItemsPerLine = std::max(1, static_cast<int>(std::min(itemsThatFit, static_cast<double>(itemsCount))));
+        info.ExtentMinorSize = availableSizeMinor;
+    }
+    else
+    {
+        // Nothing limits the line, so all the items end up in a single one.
+        info.ItemsPerLine = itemsCount;
+        info.ExtentMinorSize = std::max(0.0f, itemsCount * itemMinorSizeWithSpacing - static_cast<float>(minItemSpacing));
+    }
+
+    info.LineCount = (itemsCount + info.ItemsPerLine - 1) / info.ItemsPerLine;
+    info.ExtentMajorSize = std::max(0.0f, info.LineCount * lineSizeWithSpacing - static_cast<float>(lineSpacing));
+    return info;
+}
+
 winrt::Size FlowLayoutAlgorithm::Arrange(
     const winrt::Size& finalSize,
     const winrt::VirtualizingLayoutContext& context,
@@ -21,6 +21,17 @@ public:
         SpaceEvenly
     };
 
+    // How items of the same size wrap into lines. MeasureUniform and UniformGridLayout both
+    // go through GetUniformLayoutInfo so that the realized range, the anchors and the
+    // estimated extent agree with each other and with Generate.
+    struct UniformLayoutInfo
+    {
+        int ItemsPerLine;
+        int LineCount;
+        float ExtentMinorSize;
+        float ExtentMajorSize;
+    };
+
     FlowLayoutAlgorithm(const ITrackerHandleManager* owner) :
         m_owner(owner),
         m_elementManager(owner),
@@ -41,6 +52,18 @@ public:
         double lineSpacing,
         const ScrollOrientation& orientation,
         const wstring_view& layoutId);
+    // Measure for layouts in which every item has the same size. The realized range and
+    // the layout bounds of the items are computed in closed form from the realization
+    // rect instead of generating one item at a time through the algorithm callbacks.
+    // Falls back to Measure when the closed form does not apply.
+    winrt::Size MeasureUniform(
+        const winrt::Size& availableSize,
+        const winrt::VirtualizingLayoutContext& context,
+        const winrt::Size& itemSize,
+        double minItemSpacing,
+        double lineSpacing,
+        const ScrollOrientation& orientation,
+        const wstring_view& layoutId);
     winrt::Size Arrange(
         const winrt::Size& finalSize,
         const winrt::VirtualizingLayoutContext& context,
@@ -60,6 +83,14 @@ public:
     winrt::UIElement GetElementIfRealized(int dataindex);
     bool TryAddElement0(winrt::UIElement const& element);
 
+    static UniformLayoutInfo GetUniformLayoutInfo(
+        int itemsCount,
+        float availableSizeMinor,
+        float itemMinorSize,
+        float itemMajorSize,
+        double minItemSpacing,
+        double lineSpacing);
+
 private:
     // Types
     enum class GenerateDirection
@@ -9,14 +9,13 @@
 CppWinRTActivatableClassWithBasicFactory(IndexPath);
 
 IndexPath::IndexPath(int index)
+    : m_path(index)
 {
-    m_path.emplace_back(index);
 }
 
 IndexPath::IndexPath(int groupIndex, int itemIndex)
+    : m_path(groupIndex, itemIndex)
 {
-    m_path.emplace_back(groupIndex);
-    m_path.emplace_back(itemIndex);
 }
 
 IndexPath::IndexPath(const winrt::IVector<int>& indices)
@@ -25,70 +24,41 @@ IndexPath::IndexPath(const winrt::IVector<int>& indices)
     {
         for (auto i = 0u; i < indices.Size(); i++)
         {
-            m_path.emplace_back(indices.GetAt(i));
+            m_path.Append(indices.GetAt(i));
         }
     }
 }
 
 IndexPath::IndexPath(const std::vector<int>& indices)
+    : m_path(indices.data(), static_cast<int>(indices.size()))
+{
+}
+
+IndexPath::IndexPath(const CompactIndexPath& path)
+    : m_path(path)
+{
+}
+
+IndexPath::IndexPath(CompactIndexPath&& path)
+    : m_path(std::move(path))
 {
-    for (auto i = 0u; i < indices.size(); i++)
-    {
-        m_path.emplace_back(indices[i]);
-    }
 }
 
 #pragma region IIndexPath
 
 int32_t IndexPath::GetSize()
 {
-    return static_cast<int>(m_path.size());
+    return m_path.Size();
 }
 
 int32_t IndexPath::GetAt(int index)
 {
-    return m_path.at(index);
+    return m_path.At(index);
 }
 
 int32_t IndexPath::CompareTo(winrt::IndexPath const& rhs)
 {
-    auto rhsPath = winrt::get_self<IndexPath>(rhs);
-    int compareResult = 0;
-    int lhsCount = static_cast<int>(m_path.size());
-    int rhsCount = static_cast<int>(rhsPath->m_path.size());
-
-    if (lhsCount == 0 || rhsCount == 0)
-    {
-        // one of the paths are empty, compare based on size
-        compareResult = (lhsCount - rhsCount);
-    }
-    else
-    {
-        // both paths are non-empty, but can be of different size
-        for (int i = 0; i < std::min(lhsCount, rhsCount); i++)
-        {
-            if (m_path[i] < rhsPath->m_path[i])
-            {
-                compareResult = -1;
-                break;
-            }
-            else if (m_path[i] > rhsPath->m_path[i])
-            {
-                compareResult = 1;
-                break;
-            }
-        }
-
-        // if both match upto min(lhsCount, rhsCount), compare based on size
-        compareResult = compareResult == 0 ? (lhsCount - rhsCount) : compareResult;
-    }
-
-    if (compareResult != 0)
-    {
-        compareResult = compareResult > 0 ? 1 : -1;
-    }
-
-    return compareResult;
+    return m_path.CompareTo(PathOf(rhs));
 }
 
 #pragma endregion
@@ -98,10 +68,10 @@ int32_t IndexPath::CompareTo(winrt::IndexPath const& rhs)
 hstring IndexPath::ToString()
 {
     std::wstring result = L"R";
-    for (int index : m_path)
+    for (int i = 0; i < m_path.Size(); i++)
     {
         result.append(L".");
-        result = result + std::to_wstring(index);
+        result.append(std::to_wstring(m_path[i]));
     }
 
     return hstring{ result };
@@ -112,7 +82,7 @@ hstring IndexPath::ToString()
 bool IndexPath::IsValid() const
 {
     bool isValid = true;
-    for (int i = 0; i < static_cast<int>(m_path.size()); i++)
+    for (int i = 0; i < m_path.Size(); i++)
     {
         if (m_path[i] < 0)
         {
@@ -126,7 +96,5 @@ bool IndexPath::IsValid() const
 
 winrt::IndexPath IndexPath::CloneWithChildIndex(int childIndex) const
 {
-    auto newPath = std::vector<int>(m_path);
-    newPath.emplace_back(childIndex);
-    return winrt::make<IndexPath>(newPath);
+    return winrt::make<IndexPath>(m_path.CloneWithChildIndex(childIndex));
 }
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "IndexPath.g.h"
+#include "CompactIndexPath.h"
 
 class IndexPath : public winrt::implementation::IndexPathT<IndexPath>
 {
@@ -12,6 +13,8 @@ public:
     IndexPath(int groupIndex, int itemIndex);
     IndexPath(const winrt::IVector<int>& indices);
     IndexPath(const std::vector<int>& indices);
+    IndexPath(const CompactIndexPath& path);
+    IndexPath(CompactIndexPath&& path);
 
     template <typename ... Args>
     static winrt::IndexPath CreateFrom(Args&& ... args)
@@ -37,7 +40,13 @@ public:
 
     bool IsValid() const;
     winrt::IndexPath CloneWithChildIndex(int childIndex) const;
+    const CompactIndexPath& Path() const { return m_path; }
+
+    static const CompactIndexPath& PathOf(const winrt::IndexPath& path)
+    {
+        return winrt::get_self<IndexPath>(path)->m_path;
+    }
 
 private:
-    std::vector<int> m_path;
+    CompactIndexPath m_path;
 };
\ No newline at end of file
@@ -0,0 +1,232 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "IndexRangeSet.h"
+
+IndexRangeSet::const_iterator& IndexRangeSet::const_iterator::operator++()
+{
+    if (m_index < m_range->End())
+    {
+        ++m_index;
+    }
+    else
+    {
+        ++m_range;
+        m_index = m_range != m_rangesEnd ? m_range->Begin() : -1;
+    }
+
+    return *this;
+}
+
+IndexRangeSet::const_iterator IndexRangeSet::begin() const
+{
+    return const_iterator(m_ranges.cbegin(), m_ranges.cend());
+}
+
+IndexRangeSet::const_iterator IndexRangeSet::end() const
+{
+    return const_iterator(m_ranges.cend(), m_ranges.cend());
+}
+
+bool IndexRangeSet::Contains(int index) const
+{
+    auto it = LowerBound(index);
+    return it != m_ranges.end() && it->Begin() <= index;
+}
+
+bool IndexRangeSet::Intersects(const IndexRange& range) const
+{
+    auto it = LowerBound(range.Begin());
+    return it != m_ranges.end() && it->Begin() <= range.End();
+}
+
+IndexRangeSet::const_iterator IndexRangeSet::IteratorAt(int position) const
+{
+    MUX_ASSERT(position >= 0 && position < m_count);
+    EnsurePrefixCounts();
+
+    // Last range whose prefix count is <= position.
+    auto it = std::upper_bound(m_prefixCounts.begin(), m_prefixCounts.end(), position);
+    const auto rangeIndex = static_cast<size_t>(it - m_prefixCounts.begin()) - 1;
+    return const_iterator(
+        m_ranges.cbegin() + rangeIndex,
+        m_ranges.cend(),
+        m_ranges[rangeIndex].Begin() + (position - m_prefixCounts[rangeIndex]));
+}
+
+int IndexRangeSet::Add(const IndexRange& range)
+{
+    int begin = range.Begin();
+    int end = range.End();
+
+    // Ranges that overlap or touch [begin, end] all get folded into one.
+    auto first = LowerBound(begin - 1);
+    auto last = first;
+    int covered = 0;
+    while (last != m_ranges.end() && last->Begin() <= end + 1)
+    {
+        covered += Length(*last);
+        begin = std::min(begin, last->Begin());
+        end = std::max(end, last->End());
+        ++last;
+    }
+
+    const int added = (end - begin + 1) - covered;
+    if (added > 0)
+    {
+        if (first == last)
+        {
+            m_ranges.insert(first, IndexRange(begin, end));
+        }
+        else
+        {
+            *first = IndexRange(begin, end);
+            m_ranges.erase(first + 1, last);
+        }
+
+        m_count += added;
+        InvalidatePrefixCounts();
+    }
+
+    return added;
+}
+
+int IndexRangeSet::Remove(const IndexRange& range)
+{
+    const int begin = range.Begin();
+    const int end = range.End();
+
+    auto first = LowerBound(begin);
+    if (first == m_ranges.end() || first->Begin() > end)
+    {
+        return 0;
+    }
+
+    // A single range strictly containing the removed one gets split in two.
+    if (first->Begin() < begin && first->End() > end)
+    {
+        const IndexRange after(end + 1, first->End());
+        *first = IndexRange(first->Begin(), begin - 1);
+        m_ranges.insert(first + 1, after);
+        m_count -= end - begin + 1;
+        InvalidatePrefixCounts();
+        return end - begin + 1;
+    }
+
+    int removed = 0;
+    if (first->Begin() < begin)
+    {
+        // Keep the head of the first range.
+        removed += first->End() - begin + 1;
+        *first = IndexRange(first->Begin(), begin - 1);
+        ++first;
+    }
+
+    auto last = first;
+    while (last != m_ranges.end() && last->End() <= end)
+    {
+        removed += Length(*last);
+        ++last;
+    }
+
+    if (last != m_ranges.end() && last->Begin() <= end)
+    {
+        // Keep the tail of the last range.
+        removed += end - last->Begin() + 1;
+        *last = IndexRange(end + 1, last->End());
+    }
+
+    m_ranges.erase(first, last);
+    m_count -= removed;
+    InvalidatePrefixCounts();
+    return removed;
+}
+
+void IndexRangeSet::Clear()
+{
+    m_ranges.clear();
+    m_count = 0;
+    InvalidatePrefixCounts();
+}
+
+bool IndexRangeSet::InsertGap(int index, int count)
+{
+    auto it = LowerBound(index);
+    if (it == m_ranges.end())
+    {
+        return false;
+    }
+
+    if (it->Begin() < index)
+    {
+        // The range spans the insertion point, the part from index on moves.
+        const IndexRange after(index + count, it->End() + count);
+        *it = IndexRange(it->Begin(), index - 1);
+        it = m_ranges.insert(it + 1, after) + 1;
+    }
+
+    for (; it != m_ranges.end(); ++it)
+    {
+        *it = IndexRange(it->Begin() + count, it->End() + count);
+    }
+
+    InvalidatePrefixCounts();
+    return true;
+}
+
+bool IndexRangeSet::RemoveGap(int index, int count)
+{
+    const bool removed = Remove(IndexRange(index, index + count - 1)) > 0;
+
+    auto it = LowerBound(index);
+    if (it == m_ranges.end())
+    {
+        return removed;
+    }
+
+    for (auto shifted = it; shifted != m_ranges.end(); ++shifted)
+    {
+        *shifted = IndexRange(shifted->Begin() - count, shifted->End() - count);
+    }
+
+    // Closing the gap can make the ranges on both sides touch.
+    if (it != m_ranges.begin())
+    {
+        auto before = it - 1;
+        if (before->End() + 1 == it->Begin())
+        {
+            *before = IndexRange(before->Begin(), it->End());
+            m_ranges.erase(it);
+        }
+    }
+
+    InvalidatePrefixCounts();
+    return true;
+}
+
+std::vector<IndexRange>::iterator IndexRangeSet::LowerBound(int index)
+{
+    return std::lower_bound(m_ranges.begin(), m_ranges.end(), index, [](const IndexRange& range, int value) { return range.End() < value; });
+}
+
+std::vector<IndexRange>::const_iterator IndexRangeSet::LowerBound(int index) const
+{
+    return std::lower_bound(m_ranges.cbegin(), m_ranges.cend(), index, [](const IndexRange& range, int value) { return range.End() < value; });
+}
+
+void IndexRangeSet::EnsurePrefixCounts() const
+{
+    if (!m_prefixCountsValid)
+    {
+        m_prefixCounts.resize(m_ranges.size());
+        int count = 0;
+        for (size_t i = 0; i < m_ranges.size(); ++i)
+        {
+            m_prefixCounts[i] = count;
+            count += Length(m_ranges[i]);
+        }
+
+        m_prefixCountsValid = true;
+    }
+}
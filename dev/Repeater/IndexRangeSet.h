@@ -0,0 +1,85 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+#include "IndexRange.h"
+
+// A set of indices stored as sorted, disjoint and non-adjacent ranges. Overlapping or
+// touching ranges are coalesced as they are added, so a selection made of a few large
+// blocks stays a few entries no matter how many indices it covers.
+//   Contains:      O(log r)
+//   Add/Remove:    O(log r + k) where k is the number of ranges the new range touches
+//   Count:         O(1)
+//   At(position):  O(log r), after an O(r) rebuild of the prefix counts following a change
+// where r is the number of ranges.
+class IndexRangeSet final
+{
+public:
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const int*;
+        using reference = const int&;
+
+        const_iterator(std::vector<IndexRange>::const_iterator range, std::vector<IndexRange>::const_iterator rangesEnd) :
+            m_range(range), m_rangesEnd(rangesEnd), m_index(range != rangesEnd ? range->Begin() : -1) { }
+        const_iterator(std::vector<IndexRange>::const_iterator range, std::vector<IndexRange>::const_iterator rangesEnd, int index) :
+            m_range(range), m_rangesEnd(rangesEnd), m_index(index) { }
+
+        const int& operator*() const { return m_index; }
+        const_iterator& operator++();
+        const_iterator operator++(int) { auto result = *this; ++(*this); return result; }
+        bool operator==(const const_iterator& other) const { return m_range == other.m_range && m_index == other.m_index; }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    private:
+        std::vector<IndexRange>::const_iterator m_range;
+        std::vector<IndexRange>::const_iterator m_rangesEnd;
+        int m_index;
+    };
+
+    // Iterates the individual indices in ascending order without materializing them.
+    const_iterator begin() const;
+    const_iterator end() const;
+    // Iterator positioned on the index returned by At(position).
+    const_iterator IteratorAt(int position) const;
+
+    const std::vector<IndexRange>& Ranges() const { return m_ranges; }
+    int Count() const { return m_count; }
+    bool IsEmpty() const { return m_ranges.empty(); }
+
+    bool Contains(int index) const;
+    bool Intersects(const IndexRange& range) const;
+    // Returns the index at the given position in ascending order.
+    int At(int position) const { return *IteratorAt(position); }
+
+    // Both return the number of indices whose membership changed.
+    int Add(const IndexRange& range);
+    int Remove(const IndexRange& range);
+    void Clear();
+
+    // Collection change helpers. InsertGap shifts everything at or after index by count,
+    // splitting the range that spans index. RemoveGap drops [index, index + count - 1] and
+    // shifts what follows back. Both return true if any range was touched.
+    bool InsertGap(int index, int count);
+    bool RemoveGap(int index, int count);
+
+private:
+    // First range whose End is >= index.
+    std::vector<IndexRange>::iterator LowerBound(int index);
+    std::vector<IndexRange>::const_iterator LowerBound(int index) const;
+    void EnsurePrefixCounts() const;
+    void InvalidatePrefixCounts() { m_prefixCountsValid = false; }
+
+    static int Length(const IndexRange& range) { return range.End() - range.Begin() + 1; }
+
+    std::vector<IndexRange> m_ranges;
+    int m_count{ 0 };
+
+    // m_prefixCounts[i] is the number of indices in m_ranges[0..i).
+    mutable std::vector<int> m_prefixCounts;
+    mutable bool m_prefixCountsValid{ false };
+};
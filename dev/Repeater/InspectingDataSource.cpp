@@ -28,6 +28,7 @@ InspectingDataSource::InspectingDataSource(const winrt::IInspectable& source)
         if (bindableVector)
         {
             m_vector.set(reinterpret_cast<const winrt::IVector<winrt::IInspectable>&>(bindableVector));
+            m_isBindableVector = true;
             ListenToCollectionChanges();
         }
         else
@@ -35,14 +36,14 @@ InspectingDataSource::InspectingDataSource(const winrt::IInspectable& source)
             auto iterable = source.try_as<winrt::IIterable<winrt::IInspectable>>();
             if (iterable)
             {
-                m_vector.set(WrapIterable(iterable));
+                AdaptIterable(iterable);
             }
             else
             {
                 auto bindableIterable = source.try_as<winrt::IBindableIterable>();
                 if (bindableIterable)
                 {
-                    m_vector.set(WrapIterable(reinterpret_cast<const winrt::IIterable<winrt::IInspectable> &>(bindableIterable)));
+                    AdaptIterable(reinterpret_cast<const winrt::IIterable<winrt::IInspectable> &>(bindableIterable));
                 }
                 else
                 {
@@ -64,14 +65,59 @@ InspectingDataSource::~InspectingDataSource()
 
 int32_t InspectingDataSource::GetSizeCore()
 {
+    if (m_iterable)
+    {
+        // A second iterator could yield a different sequence than the one we cached,
+        // so the count comes from draining the iterator that fills m_vector.
+        EnsureIterated(std::numeric_limits<int>::max());
+    }
+
     return static_cast<int>(m_vector.get().Size());
 }
 
 winrt::IInspectable InspectingDataSource::GetAtCore(int index)
 {
+    if (m_iterable)
+    {
+        EnsureIterated(index);
+    }
+
     return m_vector.get().GetAt(static_cast<unsigned>(index));
 }
 
+uint32_t InspectingDataSource::GetManyCore(int startIndex, winrt::array_view<winrt::IInspectable> const& items)
+{
+    if (m_isBindableVector)
+    {
+        return ItemsSourceView::GetManyCore(startIndex, items);
+    }
+
+    if (m_iterable)
+    {
+        EnsureIterated(startIndex + static_cast<int>(items.size()) - 1);
+        if (startIndex >= static_cast<int>(m_vector.get().Size()))
+        {
+            return 0;
+        }
+    }
+
+    return m_vector.get().GetMany(static_cast<unsigned>(startIndex), items);
+}
+
+bool InspectingDataSource::IsItemCacheSupportedCore()
+{
+    // Without change notifications we would keep handing out items that the
+    // source has since replaced. Adapted iterables are already served from
+    // our own vector, so caching them again buys nothing.
+    return IsChangeTracked() && !m_isBindableVector;
+}
+
+bool InspectingDataSource::IsKeyIndexCacheSupportedCore()
+{
+    // An adapted iterable never changes, so its keys cannot go stale either.
+    return m_uniqueIdMaping && (IsChangeTracked() || m_iterable);
+}
+
 bool InspectingDataSource::HasKeyIndexMappingCore()
 {
     return m_uniqueIdMaping != nullptr;
@@ -108,6 +154,11 @@ int InspectingDataSource::IndexOf(winrt::IInspectable const& value)
     int index = -1;
     if (m_vector && value)
     {
+        if (m_iterable)
+        {
+            EnsureIterated(std::numeric_limits<int>::max());
+        }
+
         uint32_t v = static_cast<uint32_t>(-1);
         if (m_vector.get().IndexOf(value, v))
         {
@@ -117,18 +168,50 @@ int InspectingDataSource::IndexOf(winrt::IInspectable const& value)
     return index;
 }
 
-winrt::IVector<winrt::IInspectable>
-InspectingDataSource::WrapIterable(const winrt::IIterable<winrt::IInspectable>& iterable)
+bool InspectingDataSource::IsChangeTracked() const
 {
-    auto vector = winrt::make<Vector<winrt::IInspectable, MakeVectorParam<VectorFlag::DependencyObjectBase>()>>();
-    auto iterator = iterable.First();
-    while (iterator.HasCurrent())
+    return m_notifyCollectionChanged || m_observableVector || m_bindableObservableVector;
+}
+
+void InspectingDataSource::AdaptIterable(const winrt::IIterable<winrt::IInspectable>& iterable)
+{
+    m_iterable.set(iterable);
+    m_vector.set(winrt::make<Vector<winrt::IInspectable, MakeVectorParam<VectorFlag::DependencyObjectBase>()>>());
+}
+
+// Pulls items from the source iterator into m_vector until it holds the item at index
+// or the sequence ends. Without on demand iteration the whole sequence is pulled at once.
+void InspectingDataSource::EnsureIterated(int index)
+{
+    auto vector = m_vector.get();
+    if (m_isIterableExhausted || index < static_cast<int>(vector.Size()))
+    {
+        return;
+    }
+
+    if (!IsOnDemandIterationEnabled())
+    {
+        index = std::numeric_limits<int>::max();
+    }
+
+    if (!m_iterator)
+    {
+        m_iterator.set(m_iterable.get().First());
+    }
+
+    auto iterator = m_iterator.get();
+    while (index >= static_cast<int>(vector.Size()) && iterator.HasCurrent())
     {
         vector.Append(iterator.Current());
         iterator.MoveNext();
     }
 
-    return vector;
+    if (!iterator.HasCurrent())
+    {
+        // Reached the end, the sequence is now fully in m_vector.
+        m_isIterableExhausted = true;
+        m_iterator.set(nullptr);
+    }
 }
 
 void InspectingDataSource::UnListenToCollectionChanges()
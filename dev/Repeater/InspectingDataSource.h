@@ -18,6 +18,9 @@ public:
 
     int32_t GetSizeCore() override;
     winrt::IInspectable GetAtCore(int index) override;
+    uint32_t GetManyCore(int startIndex, winrt::array_view<winrt::IInspectable> const& items) override;
+    bool IsItemCacheSupportedCore() override;
+    bool IsKeyIndexCacheSupportedCore() override;
     bool HasKeyIndexMappingCore() override;
     winrt::hstring KeyFromIndexCore(int index) override;
     int IndexFromKeyCore(winrt::hstring const& id) override;
@@ -26,8 +29,9 @@ public:
     int IndexOf(winrt::IInspectable const& value);
 
 private:
-    winrt::Collections::IVector<winrt::IInspectable>
-    WrapIterable(const winrt::Collections::IIterable<winrt::IInspectable>& iterable);
+    bool IsChangeTracked() const;
+    void AdaptIterable(const winrt::Collections::IIterable<winrt::IInspectable>& iterable);
+    void EnsureIterated(int index);
 
     void UnListenToCollectionChanges();
     void ListenToCollectionChanges();
@@ -42,10 +46,22 @@ private:
 
     tracker_ref<winrt::Collections::IVector<winrt::IInspectable>> m_vector{ this };
 
+    // When the source is only an IIterable, m_vector holds the items pulled from m_iterator
+    // so far. Everything is pulled on the first read unless IsOnDemandIterationEnabled is set,
+    // in which case we only pull up to the highest index that was asked for. Count drains the
+    // same iterator, so it always matches the items that were actually yielded.
+    tracker_ref<winrt::Collections::IIterable<winrt::IInspectable>> m_iterable{ this };
+    tracker_ref<winrt::Collections::IIterator<winrt::IInspectable>> m_iterator{ this };
+    bool m_isIterableExhausted{ false };
+
     // To unhook event from data source
     tracker_ref<winrt::INotifyCollectionChanged> m_notifyCollectionChanged{ this };
     tracker_ref<winrt::IObservableVector<winrt::IInspectable>> m_observableVector{ this };
     tracker_ref<winrt::IBindableObservableVector> m_bindableObservableVector{ this };
     winrt::event_token m_eventToken{ };
     winrt::IKeyIndexMapping m_uniqueIdMaping{ nullptr };
+
+    // IBindableVector has no GetMany, so m_vector must not be asked for one when it
+    // is really a bindable vector.
+    bool m_isBindableVector{ false };
 };
\ No newline at end of file
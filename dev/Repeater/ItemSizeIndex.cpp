@@ -0,0 +1,330 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include "ItemSizeIndex.h"
+
+void ItemSizeIndex::Resize(int count)
+{
+    const int oldCount = Count();
+    if (count != oldCount)
+    {
+        if (count < oldCount)
+        {
+            OnItemsRemoved(count, oldCount - count);
+        }
+        else
+        {
+            OnItemsAdded(oldCount, count - oldCount);
+        }
+    }
+}
+
+void ItemSizeIndex::Clear()
+{
+    m_nodes.clear();
+    m_freeNodes.clear();
+    m_root = s_none;
+}
+
+void ItemSizeIndex::SetSize(int index, double size)
+{
+    assert(index >= 0 && index < Count());
+    assert(size >= 0);
+
+    // Elements get measured on every layout pass, so do not restructure the tree
+    // when the size did not change.
+    if (m_nodes[FindNode(index)].Size == size)
+    {
+        return;
+    }
+
+    int left = s_none;
+    int item = s_none;
+    int right = s_none;
+    Split(m_root, index, &left, &right);
+    Split(right, 1, &item, &right);
+    assert(m_nodes[item].Length == 1 && m_nodes[item].Left == s_none && m_nodes[item].Right == s_none);
+
+    m_nodes[item].Size = size;
+    UpdateTotals(item);
+    m_root = Merge(Merge(left, item), right);
+}
+
+void ItemSizeIndex::OnItemsAdded(int index, int count)
+{
+    // The index might not have caught up with the item count yet if the
+    // change happened before the first measure. Resize will fix it up then.
+    index = std::min(index, Count());
+    if (count > 0)
+    {
+        int left = s_none;
+        int right = s_none;
+        Split(m_root, index, &left, &right);
+        const int added = CreateNode(count, s_unmeasured);
+        m_root = Merge(Merge(left, added), right);
+    }
+}
+
+void ItemSizeIndex::OnItemsRemoved(int index, int count)
+{
+    count = std::min(count, Count() - index);
+    if (count > 0)
+    {
+        int left = s_none;
+        int removed = s_none;
+        int right = s_none;
+        Split(m_root, index, &left, &right);
+        Split(right, count, &removed, &right);
+        ReleaseNodes(removed);
+        m_root = Merge(left, right);
+    }
+}
+
+double ItemSizeIndex::GetOffset(int index, double estimatedSize, double spacing) const
+{
+    assert(index >= 0 && index <= Count());
+
+    double measuredSize = 0.0;
+    int measuredCount = 0;
+    int remaining = index;
+    int node = m_root;
+    while (node != s_none && remaining > 0)
+    {
+        const Node& current = m_nodes[node];
+        const int leftCount = ItemCountOf(current.Left);
+        if (remaining < leftCount)
+        {
+            node = current.Left;
+        }
+        else
+        {
+            if (current.Left != s_none)
+            {
+                measuredSize += m_nodes[current.Left].MeasuredSize;
+                measuredCount += m_nodes[current.Left].MeasuredCount;
+            }
+
+            remaining -= leftCount;
+            if (remaining > 0 && current.Size >= 0)
+            {
+                measuredSize += current.Size;
+                measuredCount++;
+            }
+
+            remaining -= std::min(remaining, current.Length);
+            node = current.Right;
+        }
+    }
+
+    return measuredSize + (index - measuredCount) * estimatedSize + index * spacing;
+}
+
+int ItemSizeIndex::GetIndexAt(double offset, double estimatedSize, double spacing) const
+{
+    const int count = Count();
+    if (count == 0)
+    {
+        return -1;
+    }
+
+    // Walk down the tree skipping every subtree and item that ends at or
+    // before the offset. The first item we cannot skip contains the offset.
+    int position = 0;
+    double remaining = offset;
+    int node = m_root;
+    while (node != s_none)
+    {
+        const Node& current = m_nodes[node];
+        if (current.Left != s_none)
+        {
+            const Node& left = m_nodes[current.Left];
+            const double leftSize =
+                left.MeasuredSize +
+                (left.ItemCount - left.MeasuredCount) * estimatedSize +
+                left.ItemCount * spacing;
+            if (leftSize > remaining)
+            {
+                node = current.Left;
+                continue;
+            }
+
+            remaining -= leftSize;
+            position += left.ItemCount;
+        }
+
+        const double itemSize = (current.Size >= 0 ? current.Size : estimatedSize) + spacing;
+        if (itemSize > 0)
+        {
+            const double itemsBefore = std::floor(remaining / itemSize);
+            if (itemsBefore < current.Length)
+            {
+                position += static_cast<int>(std::max(0.0, itemsBefore));
+                break;
+            }
+        }
+
+        remaining -= current.Length * itemSize;
+        position += current.Length;
+        node = current.Right;
+    }
+
+    return std::max(0, std::min(count - 1, position));
+}
+
+double ItemSizeIndex::GetTotalSize(double estimatedSize, double spacing) const
+{
+    const int count = Count();
+    return count > 0 ? GetOffset(count, estimatedSize, spacing) - spacing : 0.0;
+}
+
+int ItemSizeIndex::CreateNode(int length, double size)
+{
+    // xorshift32, the tree only needs priorities that look random.
+    m_priorityState ^= m_priorityState << 13;
+    m_priorityState ^= m_priorityState >> 17;
+    m_priorityState ^= m_priorityState << 5;
+
+    const Node node{ s_none, s_none, m_priorityState, length, size, 0, 0, 0.0 };
+    int slot;
+    if (!m_freeNodes.empty())
+    {
+        slot = m_freeNodes.back();
+        m_freeNodes.pop_back();
+        m_nodes[slot] = node;
+    }
+    else
+    {
+        slot = static_cast<int>(m_nodes.size());
+        m_nodes.push_back(node);
+    }
+
+    UpdateTotals(slot);
+    return slot;
+}
+
+void ItemSizeIndex::ReleaseNodes(int node)
+{
+    if (node != s_none)
+    {
+        ReleaseNodes(m_nodes[node].Left);
+        ReleaseNodes(m_nodes[node].Right);
+        m_freeNodes.push_back(node);
+    }
+}
+
+void ItemSizeIndex::UpdateTotals(int node)
+{
+    Node& current = m_nodes[node];
+    current.ItemCount = current.Length;
+    current.MeasuredCount = current.Size >= 0 ? 1 : 0;
+    current.MeasuredSize = current.Size >= 0 ? current.Size : 0.0;
+    for (const int child : { current.Left, current.Right })
+    {
+        if (child != s_none)
+        {
+            current.ItemCount += m_nodes[child].ItemCount;
+            current.MeasuredCount += m_nodes[child].MeasuredCount;
+            current.MeasuredSize += m_nodes[child].MeasuredSize;
+        }
+    }
+}
+
+void ItemSizeIndex::Split(int node, int count, int* left, int* right)
+{
+    if (node == s_none)
+    {
+        *left = s_none;
+        *right = s_none;
+        return;
+    }
+
+    // CreateNode can grow m_nodes, so no reference into it is held across calls.
+    const int leftCount = ItemCountOf(m_nodes[node].Left);
+    const int length = m_nodes[node].Length;
+    if (count <= leftCount)
+    {
+        int splitRight = s_none;
+        Split(m_nodes[node].Left, count, left, &splitRight);
+        m_nodes[node].Left = splitRight;
+        UpdateTotals(node);
+        *right = node;
+    }
+    else if (count >= leftCount + length)
+    {
+        int splitLeft = s_none;
+        Split(m_nodes[node].Right, count - leftCount - length, &splitLeft, right);
+        m_nodes[node].Right = splitLeft;
+        UpdateTotals(node);
+        *left = node;
+    }
+    else
+    {
+        // The split falls inside a run of unmeasured items. The node keeps the
+        // head of the run and a new node takes its tail.
+        assert(m_nodes[node].Size < 0);
+        const int lengthInLeft = count - leftCount;
+        const int tail = CreateNode(length - lengthInLeft, s_unmeasured);
+        const int rightSubtree = m_nodes[node].Right;
+        m_nodes[node].Length = lengthInLeft;
+        m_nodes[node].Right = s_none;
+        UpdateTotals(node);
+        *left = node;
+        *right = Merge(tail, rightSubtree);
+    }
+}
+
+int ItemSizeIndex::Merge(int left, int right)
+{
+    if (left == s_none)
+    {
+        return right;
+    }
+
+    if (right == s_none)
+    {
+        return left;
+    }
+
+    if (m_nodes[left].Priority > m_nodes[right].Priority)
+    {
+        const int merged = Merge(m_nodes[left].Right, right);
+        m_nodes[left].Right = merged;
+        UpdateTotals(left);
+        return left;
+    }
+    else
+    {
+        const int merged = Merge(left, m_nodes[right].Left);
+        m_nodes[right].Left = merged;
+        UpdateTotals(right);
+        return right;
+    }
+}
+
+int ItemSizeIndex::FindNode(int index) const
+{
+    int node = m_root;
+    while (node != s_none)
+    {
+        const Node& current = m_nodes[node];
+        const int leftCount = ItemCountOf(current.Left);
+        if (index < leftCount)
+        {
+            node = current.Left;
+        }
+        else if (index < leftCount + current.Length)
+        {
+            break;
+        }
+        else
+        {
+            index -= leftCount + current.Length;
+            node = current.Right;
+        }
+    }
+
+    return node;
+}
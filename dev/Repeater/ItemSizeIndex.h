@@ -0,0 +1,75 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Keeps track of the measured size (in the virtualizing direction) of every item
+// so that the offset of an index and the index at an offset can be computed in
+// O(log n). Items that have not been measured yet use the estimated size that is
+// passed in to the queries, so the estimate can change between queries without
+// having to touch the index.
+//
+// The items live in an implicit treap, a randomized balanced tree ordered by
+// position. A measured item gets a node of its own while consecutive unmeasured
+// items share one, so inserting or removing a range of items is O(log n) no matter
+// how many items it covers or how many come after it.
+class ItemSizeIndex final
+{
+public:
+    int Count() const { return ItemCountOf(m_root); }
+    int MeasuredCount() const { return m_root == s_none ? 0 : m_nodes[m_root].MeasuredCount; }
+
+    void Resize(int count);
+    void Clear();
+
+    void SetSize(int index, double size);
+    void OnItemsAdded(int index, int count);
+    void OnItemsRemoved(int index, int count);
+
+    // Offset at which the item at index starts. Passing Count() gives the
+    // offset right after the last item (including the trailing spacing).
+    double GetOffset(int index, double estimatedSize, double spacing) const;
+    // Index of the item that contains offset, clamped to [0, Count() - 1].
+    int GetIndexAt(double offset, double estimatedSize, double spacing) const;
+    double GetTotalSize(double estimatedSize, double spacing) const;
+
+private:
+    struct Node
+    {
+        int Left;
+        int Right;
+        uint32_t Priority;
+        // Number of items in this node. Only runs of unmeasured items hold more than one.
+        int Length;
+        // Size of the item, or s_unmeasured for a run of unmeasured items.
+        double Size;
+
+        // Totals over the subtree rooted at this node.
+        int ItemCount;
+        int MeasuredCount;
+        double MeasuredSize;
+    };
+
+    int ItemCountOf(int node) const { return node == s_none ? 0 : m_nodes[node].ItemCount; }
+
+    int CreateNode(int length, double size);
+    void ReleaseNodes(int node);
+    void UpdateTotals(int node);
+    // Splits the items of the subtree at node into the first count items and the rest.
+    void Split(int node, int count, int* left, int* right);
+    int Merge(int left, int right);
+    int FindNode(int index) const;
+
+    static constexpr int s_none = -1;
+    // Unmeasured items are stored as a negative size.
+    static constexpr double s_unmeasured = -1.0;
+
+    std::vector<Node> m_nodes{};
+    // Slots of m_nodes that were released and can be reused.
+    std::vector<int> m_freeNodes{};
+    int m_root{ s_none };
+    uint32_t m_priorityState{ 0x9E3779B9u };
+};
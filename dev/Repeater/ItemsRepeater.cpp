@@ -99,6 +99,17 @@ winrt::Size ItemsRepeater::MeasureOverride(winrt::Size const& availableSize)
         throw winrt::hresult_error(E_FAIL, L"Cannot run layout in the middle of a collection change.");
     }
 
+    if (!m_pendingCollectionChanges.IsEmpty())
+    {
+        m_isApplyingPendingCollectionChangesInMeasure = true;
+        auto applyingChanges = gsl::finally([this]()
+        {
+            m_isApplyingPendingCollectionChangesInMeasure = false;
+        });
+
+        ApplyPendingCollectionChanges(Layout());
+    }
+
     m_viewportManager->OnOwnerMeasuring();
 
     m_isLayoutInProgress = true;
@@ -225,11 +236,13 @@ winrt::ItemsSourceView ItemsRepeater::ItemsSourceView()
 
 int32_t ItemsRepeater::GetElementIndex(winrt::UIElement const& element)
 {
+    ApplyPendingCollectionChanges(Layout());
     return GetElementIndexImpl(element);
 }
 
 winrt::UIElement ItemsRepeater::TryGetElement(int index)
 {
+    ApplyPendingCollectionChanges(Layout());
     return GetElementFromIndexImpl(index);
 }
 
@@ -245,6 +258,7 @@ void ItemsRepeater::UnpinElement(winrt::UIElement const& element)
 
 winrt::UIElement ItemsRepeater::GetOrCreateElement(int index)
 {
+    ApplyPendingCollectionChanges(Layout());
     return GetOrCreateElementImpl(index);
 }
 
@@ -391,6 +405,14 @@ void ItemsRepeater::OnPropertyChanged(const winrt::DependencyPropertyChangedEven
     {
         m_viewportManager->VerticalCacheLength(unbox_value<double>(args.NewValue()));
     }
+    else if (property == s_IsCollectionChangeCoalescingEnabledProperty)
+    {
+        m_isCollectionChangeCoalescingEnabled = unbox_value<bool>(args.NewValue());
+        if (!m_isCollectionChangeCoalescingEnabled)
+        {
+            ApplyPendingCollectionChanges(Layout());
+        }
+    }
 }
 
 void ItemsRepeater::OnElementPrepared(const winrt::UIElement& element, int index)
@@ -430,7 +452,7 @@ void ItemsRepeater::OnElementClearing(const winrt::UIElement& element)
 
 void ItemsRepeater::OnElementIndexChanged(const winrt::UIElement& element, int oldIndex, int newIndex)
 {
-    if (m_elementIndexChangedEventSource)
+    if (m_elementIndexChangedEventSource && !m_isApplyingPendingCollectionChanges)
     {
         if (!m_elementIndexChangedArgs)
         {
@@ -498,6 +520,10 @@ void ItemsRepeater::OnDataSourcePropertyChanged(const winrt::ItemsSourceView& ol
         throw winrt::hresult_error(E_FAIL, L"Cannot set ItemsSourceView during layout.");
     }
 
+    // Pending changes belong to the old source. Bring the realized elements up to date
+    // with it before it goes away.
+    ApplyPendingCollectionChanges(Layout());
+
     m_itemsSourceView.set(newValue);
 
     if (oldValue)
@@ -547,6 +573,8 @@ void ItemsRepeater::OnItemTemplateChanged(const winrt::IElementFactory& oldValue
         throw winrt::hresult_error(E_FAIL, L"ItemTemplate cannot be changed during layout.");
     }
 
+    ApplyPendingCollectionChanges(Layout());
+
     // Since the ItemTemplate has changed, we need to re-evaluate all the items that
     // have already been created and are now in the tree. The easiest way to do that
     // would be to do a reset.. Note that this has to be done before we change the template
@@ -624,6 +652,10 @@ void ItemsRepeater::OnLayoutChanged(const winrt::Layout& oldValue, const winrt::
         throw winrt::hresult_error(E_FAIL, L"Layout cannot be changed during layout.");
     }
 
+    // The old layout is still initialized for our context at this point, so it
+    // gets to see the pending changes before its elements are cleared.
+    ApplyPendingCollectionChanges(oldValue);
+
     m_viewManager.OnLayoutChanging();
     m_animationManager.OnLayoutChanging();
 
@@ -690,6 +722,20 @@ void ItemsRepeater::OnItemsSourceViewChanged(const winrt::IInspectable& sender,
         throw winrt::hresult_error(E_FAIL, L"Changes in the data source are not allowed during another change in the data source.");
     }
 
+    if (m_isCollectionChangeCoalescingEnabled && CollectionChangeBatch::CanBuffer(args.Action()))
+    {
+        m_pendingCollectionChanges.Add(args);
+        InvalidateMeasure();
+        return;
+    }
+
+    // Changes that cannot be buffered have to be processed after the ones that came before them.
+    ApplyPendingCollectionChanges(Layout());
+    ProcessCollectionChange(Layout(), sender, args);
+}
+
+void ItemsRepeater::ProcessCollectionChange(const winrt::Layout& layout, const winrt::IInspectable& sender, const winrt::NotifyCollectionChangedEventArgs& args)
+{
     m_processingItemsSourceChange.set(args);
     auto processingChange = gsl::finally([this]()
     {
@@ -699,13 +745,13 @@ void ItemsRepeater::OnItemsSourceViewChanged(const winrt::IInspectable& sender,
     m_animationManager.OnItemsSourceChanged(sender, args);
     m_viewManager.OnItemsSourceChanged(sender, args);
 
-    if (auto layout = Layout())
+    if (layout)
     {
         if (auto virtualLayout = layout.as<winrt::VirtualizingLayout>())
         {
             virtualLayout.OnItemsChangedCore(GetLayoutContext(), sender, args);
         }
-        else
+        else if (!m_isApplyingPendingCollectionChangesInMeasure)
         {
             // NonVirtualizingLayout
             InvalidateMeasure();
@@ -713,9 +759,71 @@ void ItemsRepeater::OnItemsSourceViewChanged(const winrt::IInspectable& sender,
     }
 }
 
+void ItemsRepeater::ApplyPendingCollectionChanges(const winrt::Layout& layout)
+{
+    if (m_pendingCollectionChanges.IsEmpty())
+    {
+        return;
+    }
+
+    REPEATER_TRACE_INFO(L"Applying coalesced collection changes. %d notifications received. \n", m_pendingCollectionChanges.ReceivedCount());
+
+    // The intermediate indices the changes move the elements through do not match the source,
+    // which already holds the final items, so handlers only get to see where elements ended up.
+    std::vector<std::pair<winrt::UIElement, int>> indicesBeforeChanges;
+    if (m_elementIndexChangedEventSource)
+    {
+        auto children = Children();
+        indicesBeforeChanges.reserve(children.Size());
+        for (unsigned i = 0u; i < children.Size(); ++i)
+        {
+            auto element = children.GetAt(i);
+            auto virtInfo = GetVirtualizationInfo(element);
+            if (virtInfo->IsRealized())
+            {
+                indicesBeforeChanges.emplace_back(element, virtInfo->Index());
+            }
+        }
+    }
+
+    {
+        m_isApplyingPendingCollectionChanges = true;
+        auto applyingChanges = gsl::finally([this]()
+        {
+            m_isApplyingPendingCollectionChanges = false;
+        });
+
+        auto sender = m_itemsSourceView.get();
+        for (const auto& args : m_pendingCollectionChanges.TakeChanges())
+        {
+            ProcessCollectionChange(layout, sender, args);
+        }
+    }
+
+    for (const auto& elementAndIndex : indicesBeforeChanges)
+    {
+        auto virtInfo = GetVirtualizationInfo(elementAndIndex.first);
+        if (virtInfo->IsRealized() && virtInfo->Index() != elementAndIndex.second)
+        {
+            OnElementIndexChanged(elementAndIndex.first, elementAndIndex.second, virtInfo->Index());
+        }
+    }
+}
+
+void ItemsRepeater::FlushPendingCollectionChanges()
+{
+    if (!m_isLayoutInProgress && !IsProcessingCollectionChange())
+    {
+        ApplyPendingCollectionChanges(Layout());
+    }
+}
+
 void ItemsRepeater::InvalidateMeasureForLayout(winrt::Layout const&, winrt::IInspectable const&)
 {
-    InvalidateMeasure();
+    if (!m_isApplyingPendingCollectionChangesInMeasure)
+    {
+        InvalidateMeasure();
+    }
 }
 
 void ItemsRepeater::InvalidateArrangeForLayout(winrt::Layout const&, winrt::IInspectable const&)
@@ -734,6 +842,9 @@ winrt::VirtualizingLayoutContext ItemsRepeater::GetLayoutContext()
 
 winrt::IIterable<winrt::DependencyObject> ItemsRepeater::CreateChildrenInTabFocusOrderIterable()
 {
+    // Children are ordered by index.
+    FlushPendingCollectionChanges();
+
     auto children = Children();
     if (children.Size() > 0u)
     {
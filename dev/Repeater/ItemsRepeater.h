@@ -4,6 +4,7 @@
 #pragma once
 
 #include "AnimationManager.h"
+#include "CollectionChangeBatch.h"
 #include "ViewManager.h"
 #include "VirtualizationInfo.h"
 #include "ItemsRepeaterElementPreparedEventArgs.h"
@@ -107,6 +108,11 @@ public:
     void OnElementClearing(const winrt::UIElement& element);
     void OnElementIndexChanged(const winrt::UIElement& element, int oldIndex, int newIndex);
 
+    // Processes the collection changes buffered while IsCollectionChangeCoalescingEnabled is set.
+    // Until then the indices of realized elements lag behind the source, so anything that maps
+    // them to data outside of measure calls this first.
+    void FlushPendingCollectionChanges();
+
     static winrt::DependencyProperty GetVirtualizationInfoProperty()
     {
         static GlobalDependencyProperty s_VirtualizationInfoProperty =
@@ -132,6 +138,10 @@ private:
     void OnAnimatorChanged(const winrt::ElementAnimator& oldValue, const winrt::ElementAnimator& newValue);
 
     void OnItemsSourceViewChanged(const winrt::IInspectable& sender, const winrt::NotifyCollectionChangedEventArgs& args);
+    void ProcessCollectionChange(const winrt::Layout& layout, const winrt::IInspectable& sender, const winrt::NotifyCollectionChangedEventArgs& args);
+    // Processes the changes buffered while IsCollectionChangeCoalescingEnabled is set. The layout is passed
+    // in because the Layout property already holds the new value when we flush from OnLayoutChanged.
+    void ApplyPendingCollectionChanges(const winrt::Layout& layout);
     void InvalidateMeasureForLayout(winrt::Layout const& sender, winrt::IInspectable const& args);
     void InvalidateArrangeForLayout(winrt::Layout const& sender, winrt::IInspectable const& args);
 
@@ -154,6 +164,14 @@ private:
     tracker_ref<winrt::IInspectable> m_layoutState{ this };
     // Value is different from null only while we are on the OnItemsSourceChanged call stack.
     tracker_ref<winrt::NotifyCollectionChangedEventArgs> m_processingItemsSourceChange{ this };
+    CollectionChangeBatch m_pendingCollectionChanges{ this };
+    bool m_isCollectionChangeCoalescingEnabled{ false };
+    // True while the pending changes are being applied from MeasureOverride. Invalidating
+    // measure from there would only schedule a redundant layout pass.
+    bool m_isApplyingPendingCollectionChangesInMeasure{ false };
+    // True while the pending changes are being applied. ElementIndexChanged is held back meanwhile
+    // since the source already holds the final items, and raised once per element afterwards.
+    bool m_isApplyingPendingCollectionChanges{ false };
 
     winrt::Size m_lastAvailableSize{};
     bool m_isLayoutInProgress{ false };
@@ -3,9 +3,11 @@
 
 #include <pch.h>
 #include <common.h>
+#include <BindableVector.h>
 #include "ItemsRepeater.common.h"
 #include "ItemsSourceView.h"
 #include "InspectingDataSource.h"
+#include "SequenceDiff.h"
 
 #pragma region IDataSource
 
@@ -23,9 +25,57 @@ int32_t ItemsSourceView::Count()
 
 winrt::IInspectable ItemsSourceView::GetAt(int index)
 {
+    if (IsItemCacheSupportedCore() && index >= 0 && index < Count())
+    {
+        return GetCachedItem(index);
+    }
+
     return GetAtCore(index);
 }
 
+uint32_t ItemsSourceView::GetMany(int startIndex, winrt::array_view<winrt::IInspectable> const& items)
+{
+    const int count = Count();
+    if (startIndex < 0 || startIndex > count)
+    {
+        throw winrt::hresult_out_of_bounds();
+    }
+
+    const auto howMany = std::min(static_cast<uint32_t>(count - startIndex), items.size());
+    if (howMany == 0)
+    {
+        return 0;
+    }
+
+    return GetManyCore(startIndex, winrt::array_view<winrt::IInspectable>(items.begin(), items.begin() + howMany));
+}
+
+bool ItemsSourceView::IsResetDiffingEnabled()
+{
+    return m_isResetDiffingEnabled;
+}
+
+void ItemsSourceView::IsResetDiffingEnabled(bool value)
+{
+    m_isResetDiffingEnabled = value;
+    if (!value)
+    {
+        ClearResetDiffingItems();
+    }
+
+    EnsureResetDiffingSnapshot();
+}
+
+bool ItemsSourceView::IsOnDemandIterationEnabled()
+{
+    return m_isOnDemandIterationEnabled;
+}
+
+void ItemsSourceView::IsOnDemandIterationEnabled(bool value)
+{
+    m_isOnDemandIterationEnabled = value;
+}
+
 bool ItemsSourceView::HasKeyIndexMapping()
 {
     return HasKeyIndexMappingCore();
@@ -33,11 +83,30 @@ bool ItemsSourceView::HasKeyIndexMapping()
 
 winrt::hstring ItemsSourceView::KeyFromIndex(int index)
 {
+    if (m_keyIndexCache.IsBuilt() && index >= 0 && index < m_keyIndexCache.Count())
+    {
+        return m_keyIndexCache.KeyFromIndex(index);
+    }
+
     return KeyFromIndexCore(index);
 }
 
 int ItemsSourceView::IndexFromKey(winrt::hstring const& id)
 {
+    if (IsKeyIndexCacheSupportedCore())
+    {
+        if (!m_keyIndexCache.IsBuilt())
+        {
+            m_keyIndexCache.Build(Count(), [this](int index) { return KeyFromIndexCore(index); });
+        }
+
+        const int index = m_keyIndexCache.IndexFromKey(id);
+        if (index >= 0)
+        {
+            return index;
+        }
+    }
+
     return IndexFromKeyCore(id);
 }
 
@@ -57,7 +126,22 @@ void ItemsSourceView::CollectionChanged(winrt::event_token const& token)
 
 void ItemsSourceView::OnItemsSourceChanged(winrt::NotifyCollectionChangedEventArgs const& args)
 {
+    if (m_isResetDiffingEnabled &&
+        args.Action() == winrt::NotifyCollectionChangedAction::Reset &&
+        m_keyIndexCache.IsBuilt() &&
+        m_areResetDiffingItemsValid)
+    {
+        RaiseResetAsEdits(args);
+        return;
+    }
+
+    InvalidateItemCache();
+    UpdateKeyIndexCache(args);
+    UpdateResetDiffingItems(args);
     m_cachedSize = GetSizeCore();
+    // A Reset taken this way, or a change the cache could not be patched for, left no snapshot
+    // for the next Reset to be diffed against.
+    EnsureResetDiffingSnapshot();
     m_collectionChangedEventSource(*this, args);
 }
 
@@ -75,6 +159,26 @@ winrt::IInspectable ItemsSourceView::GetAtCore(int /* index */)
     throw winrt::hresult_not_implemented();
 }
 
+uint32_t ItemsSourceView::GetManyCore(int startIndex, winrt::array_view<winrt::IInspectable> const& items)
+{
+    for (uint32_t i = 0; i < items.size(); i++)
+    {
+        items[i] = GetAtCore(startIndex + static_cast<int>(i));
+    }
+
+    return items.size();
+}
+
+bool ItemsSourceView::IsItemCacheSupportedCore()
+{
+    return false;
+}
+
+bool ItemsSourceView::IsKeyIndexCacheSupportedCore()
+{
+    return false;
+}
+
 bool ItemsSourceView::HasKeyIndexMappingCore()
 {
     throw winrt::hresult_not_implemented();
@@ -90,4 +194,461 @@ int ItemsSourceView::IndexFromKeyCore(winrt::hstring const& /* id */)
     throw winrt::hresult_not_implemented();
 }
 
-#pragma endregion
\ No newline at end of file
+#pragma endregion
+
+void ItemsSourceView::ResetItemCacheCounters()
+{
+    m_itemCacheHitCount = 0;
+    m_itemCacheMissCount = 0;
+}
+
+winrt::IInspectable ItemsSourceView::GetCachedItem(int index)
+{
+    const int windowStart = index - index % s_itemCacheWindowSize;
+    for (auto& window : m_itemCacheWindows)
+    {
+        if (window.StartIndex == windowStart && index - windowStart < window.Count)
+        {
+            ++m_itemCacheHitCount;
+            return window.Items[index - windowStart].get();
+        }
+    }
+
+    ++m_itemCacheMissCount;
+
+    if (m_itemCacheWindows.empty())
+    {
+        m_itemCacheWindows.resize(s_itemCacheWindowCount);
+        for (auto& window : m_itemCacheWindows)
+        {
+            window.Items.reserve(s_itemCacheWindowSize);
+            for (int i = 0; i < s_itemCacheWindowSize; i++)
+            {
+                window.Items.emplace_back(this);
+            }
+        }
+
+        m_itemCacheFetchBuffer.resize(s_itemCacheWindowSize);
+    }
+
+    // Fill the oldest window with the range around index.
+    auto& window = m_itemCacheWindows[m_nextItemCacheWindow];
+    m_nextItemCacheWindow = (m_nextItemCacheWindow + 1) % s_itemCacheWindowCount;
+
+    const int count = std::min(s_itemCacheWindowSize, Count() - windowStart);
+    const auto fetched = static_cast<int>(GetManyCore(
+        windowStart,
+        winrt::array_view<winrt::IInspectable>(m_itemCacheFetchBuffer.data(), m_itemCacheFetchBuffer.data() + count)));
+
+    for (int i = 0; i < fetched; i++)
+    {
+        window.Items[i].set(m_itemCacheFetchBuffer[i]);
+        m_itemCacheFetchBuffer[i] = nullptr;
+    }
+
+    for (int i = fetched; i < window.Count; i++)
+    {
+        window.Items[i].set(nullptr);
+    }
+
+    window.StartIndex = windowStart;
+    window.Count = fetched;
+
+    if (index - windowStart < fetched)
+    {
+        return window.Items[index - windowStart].get();
+    }
+
+    // The source returned fewer items than it reported, let it report the error.
+    return GetAtCore(index);
+}
+
+void ItemsSourceView::InvalidateItemCache()
+{
+    for (auto& window : m_itemCacheWindows)
+    {
+        for (int i = 0; i < window.Count; i++)
+        {
+            window.Items[i].set(nullptr);
+        }
+
+        window.StartIndex = -1;
+        window.Count = 0;
+    }
+}
+
+void ItemsSourceView::UpdateKeyIndexCache(winrt::NotifyCollectionChangedEventArgs const& args)
+{
+    if (!m_keyIndexCache.IsBuilt())
+    {
+        return;
+    }
+
+    auto keyFromIndex = [this](int index) { return KeyFromIndexCore(index); };
+    const auto newItems = args.NewItems();
+    const auto oldItems = args.OldItems();
+
+    switch (args.Action())
+    {
+    case winrt::NotifyCollectionChangedAction::Add:
+        if (newItems && args.NewStartingIndex() >= 0)
+        {
+            m_keyIndexCache.OnItemsAdded(args.NewStartingIndex(), static_cast<int>(newItems.Size()), keyFromIndex);
+            return;
+        }
+        break;
+    case winrt::NotifyCollectionChangedAction::Remove:
+        if (oldItems && args.OldStartingIndex() >= 0)
+        {
+            m_keyIndexCache.OnItemsRemoved(args.OldStartingIndex(), static_cast<int>(oldItems.Size()));
+            return;
+        }
+        break;
+    case winrt::NotifyCollectionChangedAction::Replace:
+        if (newItems && args.NewStartingIndex() >= 0)
+        {
+            m_keyIndexCache.OnItemsReplaced(args.NewStartingIndex(), static_cast<int>(newItems.Size()), keyFromIndex);
+            return;
+        }
+        break;
+    case winrt::NotifyCollectionChangedAction::Move:
+        if (newItems && args.OldStartingIndex() >= 0 && args.NewStartingIndex() >= 0)
+        {
+            m_keyIndexCache.OnItemsMoved(args.OldStartingIndex(), args.NewStartingIndex(), static_cast<int>(newItems.Size()));
+            return;
+        }
+        break;
+    default:
+        break;
+    }
+
+    // Reset, or a change without the details needed to patch the cache. It is
+    // rebuilt on the next IndexFromKey.
+    m_keyIndexCache.Clear();
+}
+
+void ItemsSourceView::UpdateResetDiffingItems(winrt::NotifyCollectionChangedEventArgs const& args)
+{
+    if (!m_areResetDiffingItemsValid)
+    {
+        return;
+    }
+
+    // The items follow the keys: if these could not be patched, neither can the items.
+    if (!m_keyIndexCache.IsBuilt())
+    {
+        ClearResetDiffingItems();
+        return;
+    }
+
+    const auto newItems = args.NewItems();
+    auto toTrackerRefs = [this](winrt::IBindableVector const& items)
+    {
+        std::vector<tracker_ref<winrt::IInspectable>> refs;
+        refs.reserve(items.Size());
+        for (uint32_t i = 0; i < items.Size(); i++)
+        {
+            refs.emplace_back(this, items.GetAt(i));
+        }
+        return refs;
+    };
+
+    switch (args.Action())
+    {
+    case winrt::NotifyCollectionChangedAction::Add:
+    {
+        auto added = toTrackerRefs(newItems);
+        m_resetDiffingItems.insert(
+            m_resetDiffingItems.begin() + args.NewStartingIndex(),
+            std::make_move_iterator(added.begin()),
+            std::make_move_iterator(added.end()));
+        break;
+    }
+    case winrt::NotifyCollectionChangedAction::Remove:
+    {
+        const auto first = m_resetDiffingItems.begin() + args.OldStartingIndex();
+        m_resetDiffingItems.erase(first, first + args.OldItems().Size());
+        break;
+    }
+    case winrt::NotifyCollectionChangedAction::Replace:
+    {
+        const int index = args.NewStartingIndex();
+        for (uint32_t i = 0; i < newItems.Size(); i++)
+        {
+            m_resetDiffingItems[index + i].set(newItems.GetAt(i));
+        }
+        break;
+    }
+    case winrt::NotifyCollectionChangedAction::Move:
+    {
+        const int oldIndex = args.OldStartingIndex();
+        const int newIndex = args.NewStartingIndex();
+        const int count = static_cast<int>(newItems.Size());
+        const auto first = m_resetDiffingItems.begin();
+        if (oldIndex < newIndex)
+        {
+            std::rotate(first + oldIndex, first + oldIndex + count, first + newIndex + count);
+        }
+        else if (newIndex < oldIndex)
+        {
+            std::rotate(first + newIndex, first + oldIndex, first + oldIndex + count);
+        }
+        break;
+    }
+    default:
+        MUX_ASSERT(false);
+        break;
+    }
+
+    MUX_ASSERT(static_cast<int>(m_resetDiffingItems.size()) == m_keyIndexCache.Count());
+}
+
+void ItemsSourceView::SetResetDiffingItems(const std::vector<winrt::IInspectable>& items)
+{
+    m_resetDiffingItems.clear();
+    m_resetDiffingItems.reserve(items.size());
+    for (auto const& item : items)
+    {
+        m_resetDiffingItems.emplace_back(this, item);
+    }
+
+    m_areResetDiffingItemsValid = true;
+}
+
+void ItemsSourceView::ClearResetDiffingItems()
+{
+    m_resetDiffingItems.clear();
+    m_areResetDiffingItemsValid = false;
+}
+
+void ItemsSourceView::EnsureResetDiffingSnapshot()
+{
+    if (m_isResetDiffingEnabled && IsKeyIndexCacheSupportedCore())
+    {
+        // Take the snapshot now, by the time a Reset arrives the old keys and items are gone.
+        if (!m_keyIndexCache.IsBuilt())
+        {
+            m_keyIndexCache.Build(Count(), [this](int index) { return KeyFromIndexCore(index); });
+        }
+
+        if (!m_areResetDiffingItemsValid)
+        {
+            std::vector<winrt::IInspectable> items(m_keyIndexCache.Count());
+            for (int i = 0; i < m_keyIndexCache.Count(); i++)
+            {
+                items[i] = GetAt(i);
+            }
+
+            SetResetDiffingItems(items);
+        }
+    }
+}
+
+void ItemsSourceView::RaiseResetAsEdits(winrt::NotifyCollectionChangedEventArgs const& args)
+{
+    InvalidateItemCache();
+
+    const int newCount = GetSizeCore();
+    std::vector<winrt::hstring> newKeys;
+    std::vector<winrt::IInspectable> newItems(newCount);
+    newKeys.reserve(newCount);
+    for (int i = 0; i < newCount; i++)
+    {
+        newKeys.push_back(KeyFromIndexCore(i));
+    }
+
+    const int fetched = newCount > 0 ?
+        static_cast<int>(GetManyCore(0, winrt::array_view<winrt::IInspectable>(newItems.data(), newItems.data() + newCount))) :
+        0;
+    for (int i = fetched; i < newCount; i++)
+    {
+        // The source returned fewer items than it reported, let it report the error.
+        newItems[i] = GetAtCore(i);
+    }
+
+    // Diff small integer ids instead of the strings themselves.
+    std::unordered_map<winrt::hstring, int> keyIds;
+    auto toIds = [&keyIds](const std::vector<winrt::hstring>& keys)
+    {
+        std::vector<int> ids;
+        ids.reserve(keys.size());
+        for (const auto& key : keys)
+        {
+            ids.push_back(keyIds.emplace(key, static_cast<int>(keyIds.size())).first->second);
+        }
+        return ids;
+    };
+
+    const auto oldIds = toIds(m_keyIndexCache.Keys());
+    const auto newIds = toIds(newKeys);
+    std::vector<SequenceDiff::Edit> edits;
+    const bool diffed = SequenceDiff::TryComputeEdits(oldIds, newIds, s_maxResetDiffEdits, edits);
+
+    std::vector<winrt::IInspectable> oldItems;
+    oldItems.reserve(m_resetDiffingItems.size());
+    for (auto const& item : m_resetDiffingItems)
+    {
+        oldItems.push_back(item.get());
+    }
+
+    MUX_ASSERT(oldItems.size() == oldIds.size());
+
+    m_keyIndexCache.Build(std::move(newKeys));
+    SetResetDiffingItems(newItems);
+
+    if (!diffed)
+    {
+        m_cachedSize = newCount;
+        m_collectionChangedEventSource(*this, args);
+        return;
+    }
+
+    REPEATER_TRACE_INFO(L"ItemsSourceView: Reset raised as %d edits\n", static_cast<int>(edits.size()));
+
+    auto makeItems = [](const std::vector<winrt::IInspectable>& source, int start, int count)
+    {
+        auto items = winrt::make<Vector<winrt::IInspectable, MakeVectorParam<VectorFlag::Bindable>()>>();
+        for (int i = start; i < start + count; i++)
+        {
+            items.Append(source[i]);
+        }
+        return items;
+    };
+    const auto noItems = winrt::make<Vector<winrt::IInspectable, MakeVectorParam<VectorFlag::Bindable>()>>();
+
+    // Before each edit the sequence is newItems[0, newIndex) followed by oldItems[oldIndex, oldCount),
+    // so the items kept between two edits pair up one to one. Surviving keys whose item is no longer
+    // the same object are raised as Replace once the edits are done, at their final indices.
+    const int oldCount = static_cast<int>(oldItems.size());
+    int oldIndex = 0;
+    int newIndex = 0;
+    std::vector<int> replacedIndices;
+    std::vector<int> replacedOldIndices;
+    auto keep = [&](int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (!IsSameItem(oldItems[oldIndex + i], newItems[newIndex + i]))
+            {
+                replacedOldIndices.push_back(oldIndex + i);
+                replacedIndices.push_back(newIndex + i);
+            }
+        }
+
+        oldIndex += count;
+        newIndex += count;
+    };
+
+    // The source already holds the new items while these are raised. Count follows the
+    // edits so that it agrees with the indices of each notification.
+    int count = oldCount;
+    for (const auto& edit : edits)
+    {
+        keep(edit.Index - newIndex);
+
+        const bool isInsert = edit.Kind == SequenceDiff::EditKind::Insert;
+        count += isInsert ? edit.Count : -edit.Count;
+        m_cachedSize = count;
+
+        if (isInsert)
+        {
+            m_collectionChangedEventSource(*this,
+                winrt::NotifyCollectionChangedEventArgs(
+                    winrt::NotifyCollectionChangedAction::Add,
+                    makeItems(newItems, newIndex, edit.Count),
+                    noItems,
+                    edit.Index,
+                    -1));
+            newIndex += edit.Count;
+        }
+        else
+        {
+            m_collectionChangedEventSource(*this,
+                winrt::NotifyCollectionChangedEventArgs(
+                    winrt::NotifyCollectionChangedAction::Remove,
+                    noItems,
+                    makeItems(oldItems, oldIndex, edit.Count),
+                    -1,
+                    edit.Index));
+            oldIndex += edit.Count;
+        }
+    }
+
+    keep(oldCount - oldIndex);
+    MUX_ASSERT(count == newCount);
+    MUX_ASSERT(newIndex == newCount);
+    m_cachedSize = newCount;
+
+    // One Replace per run of consecutive indices.
+    for (size_t runStart = 0; runStart < replacedIndices.size();)
+    {
+        size_t runEnd = runStart + 1;
+        while (runEnd < replacedIndices.size() &&
+            replacedIndices[runEnd] == replacedIndices[runEnd - 1] + 1 &&
+            replacedOldIndices[runEnd] == replacedOldIndices[runEnd - 1] + 1)
+        {
+            ++runEnd;
+        }
+
+        const int index = replacedIndices[runStart];
+        const int runCount = static_cast<int>(runEnd - runStart);
+        m_collectionChangedEventSource(*this,
+            winrt::NotifyCollectionChangedEventArgs(
+                winrt::NotifyCollectionChangedAction::Replace,
+                makeItems(newItems, index, runCount),
+                makeItems(oldItems, replacedOldIndices[runStart], runCount),
+                index,
+                index));
+        runStart = runEnd;
+    }
+}
+
+/* static */
+bool ItemsSourceView::IsSameItem(winrt::IInspectable const& left, winrt::IInspectable const& right)
+{
+    if (left == right)
+    {
+        return true;
+    }
+
+    // Values are boxed again each time they cross the ABI, so two reads of the same string
+    // or number are different objects.
+    const auto leftValue = left.try_as<winrt::IPropertyValue>();
+    const auto rightValue = right.try_as<winrt::IPropertyValue>();
+    if (!leftValue || !rightValue || leftValue.Type() != rightValue.Type())
+    {
+        return false;
+    }
+
+    switch (leftValue.Type())
+    {
+    case winrt::PropertyType::String:
+        return leftValue.GetString() == rightValue.GetString();
+    case winrt::PropertyType::Boolean:
+        return leftValue.GetBoolean() == rightValue.GetBoolean();
+    case winrt::PropertyType::Char16:
+        return leftValue.GetChar16() == rightValue.GetChar16();
+    case winrt::PropertyType::UInt8:
+        return leftValue.GetUInt8() == rightValue.GetUInt8();
+    case winrt::PropertyType::Int16:
+        return leftValue.GetInt16() == rightValue.GetInt16();
+    case winrt::PropertyType::UInt16:
+        return leftValue.GetUInt16() == rightValue.GetUInt16();
+    case winrt::PropertyType::Int32:
+        return leftValue.GetInt32() == rightValue.GetInt32();
+    case winrt::PropertyType::UInt32:
+        return leftValue.GetUInt32() == rightValue.GetUInt32();
+    case winrt::PropertyType::Int64:
+        return leftValue.GetInt64() == rightValue.GetInt64();
+    case winrt::PropertyType::UInt64:
+        return leftValue.GetUInt64() == rightValue.GetUInt64();
+    case winrt::PropertyType::Single:
+        return leftValue.GetSingle() == rightValue.GetSingle();
+    case winrt::PropertyType::Double:
+        return leftValue.GetDouble() == rightValue.GetDouble();
+    case winrt::PropertyType::Guid:
+        return leftValue.GetGuid() == rightValue.GetGuid();
+    default:
+        return false;
+    }
+}
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "ItemsSourceView.g.h"
+#include "KeyIndexCache.h"
 
 class ItemsSourceView :
     public ReferenceTracker<ItemsSourceView, winrt::implementation::ItemsSourceViewT, winrt::composing>
@@ -13,6 +14,13 @@ public:
 #pragma region IDataSource
     int32_t Count();
     winrt::IInspectable GetAt(int index);
+    uint32_t GetMany(int startIndex, winrt::array_view<winrt::IInspectable> const& items);
+
+    bool IsResetDiffingEnabled();
+    void IsResetDiffingEnabled(bool value);
+
+    bool IsOnDemandIterationEnabled();
+    void IsOnDemandIterationEnabled(bool value);
 
     bool HasKeyIndexMapping();
     winrt::hstring KeyFromIndex(int index);
@@ -27,13 +35,68 @@ public:
 
     virtual int32_t GetSizeCore();
     virtual winrt::IInspectable GetAtCore(int index);
+    virtual uint32_t GetManyCore(int startIndex, winrt::array_view<winrt::IInspectable> const& items);
+    // True if items can be served from the item cache, which needs a source that reports its
+    // changes and reads a range of items in a single call.
+    virtual bool IsItemCacheSupportedCore();
+    // True if keys can be served from m_keyIndexCache, which needs a source that maps keys
+    // and reports its changes.
+    virtual bool IsKeyIndexCacheSupportedCore();
 
     virtual bool HasKeyIndexMappingCore();
     virtual winrt::hstring KeyFromIndexCore(int index);
     virtual int IndexFromKeyCore(winrt::hstring const& id);
 #pragma endregion
 
+    int ItemCacheHitCount() const { return m_itemCacheHitCount; }
+    int ItemCacheMissCount() const { return m_itemCacheMissCount; }
+    void ResetItemCacheCounters();
+
 private:
+    winrt::IInspectable GetCachedItem(int index);
+    void InvalidateItemCache();
+    void UpdateKeyIndexCache(winrt::NotifyCollectionChangedEventArgs const& args);
+    void UpdateResetDiffingItems(winrt::NotifyCollectionChangedEventArgs const& args);
+    void SetResetDiffingItems(const std::vector<winrt::IInspectable>& items);
+    void ClearResetDiffingItems();
+    void EnsureResetDiffingSnapshot();
+    static bool IsSameItem(winrt::IInspectable const& left, winrt::IInspectable const& right);
+    void RaiseResetAsEdits(winrt::NotifyCollectionChangedEventArgs const& args);
+
+    // GetAt reads through a small ring of windows. Each window holds up to s_itemCacheWindowSize
+    // consecutive items starting at a multiple of s_itemCacheWindowSize and is filled with one
+    // GetManyCore call on a miss. All windows are dropped whenever the source reports a change.
+    static constexpr int s_itemCacheWindowSize = 64;
+    static constexpr int s_itemCacheWindowCount = 4;
+    // Past this many removed plus inserted items a Reset is raised as is; re-preparing
+    // everything is then no worse than applying the edits.
+    static constexpr int s_maxResetDiffEdits = 1000;
+
+    struct ItemCacheWindow
+    {
+        int StartIndex{ -1 };
+        int Count{ 0 };
+        std::vector<tracker_ref<winrt::IInspectable>> Items;
+    };
+
     event_source<winrt::NotifyCollectionChangedEventHandler> m_collectionChangedEventSource{ this };
     int m_cachedSize{ -1 };
+
+    std::vector<ItemCacheWindow> m_itemCacheWindows;
+    std::vector<winrt::IInspectable> m_itemCacheFetchBuffer;
+    int m_nextItemCacheWindow{ 0 };
+    int m_itemCacheHitCount{ 0 };
+    int m_itemCacheMissCount{ 0 };
+
+    // Built the first time IndexFromKey is called, and kept built while reset diffing is on
+    // since it doubles as the snapshot of keys a Reset is diffed against.
+    KeyIndexCache m_keyIndexCache;
+    bool m_isResetDiffingEnabled{ false };
+    // Items matching the keys of m_keyIndexCache while reset diffing is enabled. A Reset hands
+    // them to its Remove notifications and compares them with the new items to raise Replace
+    // for the surviving keys whose item changed.
+    std::vector<tracker_ref<winrt::IInspectable>> m_resetDiffingItems;
+    bool m_areResetDiffingItemsValid{ false };
+
+    bool m_isOnDemandIterationEnabled{ false };
 };
\ No newline at end of file
@@ -0,0 +1,139 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "KeyIndexCache.h"
+
+void KeyIndexCache::Build(int count, const KeyFromIndexFunc& keyFromIndex)
+{
+    m_keys.clear();
+    m_keys.reserve(count);
+    for (int i = 0; i < count; i++)
+    {
+        m_keys.push_back(keyFromIndex(i));
+    }
+
+    m_isBuilt = true;
+    m_areIndicesValid = false;
+}
+
+void KeyIndexCache::Build(std::vector<winrt::hstring>&& keys)
+{
+    m_keys = std::move(keys);
+    m_isBuilt = true;
+    m_areIndicesValid = false;
+}
+
+void KeyIndexCache::Clear()
+{
+    m_keys.clear();
+    m_indices.clear();
+    m_isBuilt = false;
+    m_areIndicesValid = false;
+}
+
+const winrt::hstring& KeyIndexCache::KeyFromIndex(int index) const
+{
+    MUX_ASSERT(m_isBuilt);
+    return m_keys.at(index);
+}
+
+int KeyIndexCache::IndexFromKey(const winrt::hstring& key)
+{
+    MUX_ASSERT(m_isBuilt);
+    EnsureIndices();
+    auto it = m_indices.find(key);
+    return it != m_indices.end() ? it->second : -1;
+}
+
+void KeyIndexCache::OnItemsAdded(int index, int count, const KeyFromIndexFunc& keyFromIndex)
+{
+    if (!m_isBuilt)
+    {
+        return;
+    }
+
+    MUX_ASSERT(index >= 0 && index <= Count());
+    const bool isAppend = index == Count();
+    m_keys.insert(m_keys.begin() + index, count, winrt::hstring{});
+    for (int i = index; i < index + count; i++)
+    {
+        m_keys[i] = keyFromIndex(i);
+        if (isAppend && m_areIndicesValid)
+        {
+            // Nothing moved, so the map only needs the new keys.
+            m_indices.emplace(m_keys[i], i);
+        }
+    }
+
+    m_areIndicesValid &= isAppend;
+}
+
+void KeyIndexCache::OnItemsRemoved(int index, int count)
+{
+    if (!m_isBuilt)
+    {
+        return;
+    }
+
+    MUX_ASSERT(index >= 0 && index + count <= Count());
+    m_keys.erase(m_keys.begin() + index, m_keys.begin() + index + count);
+    m_areIndicesValid = false;
+}
+
+void KeyIndexCache::OnItemsReplaced(int index, int count, const KeyFromIndexFunc& keyFromIndex)
+{
+    if (!m_isBuilt)
+    {
+        return;
+    }
+
+    MUX_ASSERT(index >= 0 && index + count <= Count());
+    for (int i = index; i < index + count; i++)
+    {
+        m_keys[i] = keyFromIndex(i);
+    }
+
+    m_areIndicesValid = false;
+}
+
+void KeyIndexCache::OnItemsMoved(int oldIndex, int newIndex, int count)
+{
+    if (!m_isBuilt)
+    {
+        return;
+    }
+
+    MUX_ASSERT(oldIndex >= 0 && oldIndex + count <= Count());
+    MUX_ASSERT(newIndex >= 0 && newIndex + count <= Count());
+
+    // The moved keys stay valid, only their positions change.
+    const auto first = m_keys.begin();
+    if (oldIndex < newIndex)
+    {
+        std::rotate(first + oldIndex, first + oldIndex + count, first + newIndex + count);
+    }
+    else if (newIndex < oldIndex)
+    {
+        std::rotate(first + newIndex, first + oldIndex, first + oldIndex + count);
+    }
+
+    m_areIndicesValid = false;
+}
+
+void KeyIndexCache::EnsureIndices()
+{
+    if (!m_areIndicesValid)
+    {
+        m_indices.clear();
+        m_indices.reserve(m_keys.size());
+        for (int i = 0; i < Count(); i++)
+        {
+            // emplace keeps the first index of a duplicated key, like a linear search would.
+            m_indices.emplace(m_keys[i], i);
+        }
+
+        m_areIndicesValid = true;
+    }
+}
@@ -0,0 +1,40 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Keys of every item of a source that implements IKeyIndexMapping, plus a key to index hash
+// map over them. The key list is built once and then patched with each collection change so
+// that IndexFromKey does not fall back to the source's own (often linear) lookup. The hash map
+// is rebuilt from the key list, without calling into the source, the first time it is needed
+// after a change that shifted indices.
+class KeyIndexCache final
+{
+public:
+    using KeyFromIndexFunc = std::function<winrt::hstring(int /*index*/)>;
+
+    bool IsBuilt() const { return m_isBuilt; }
+    int Count() const { return static_cast<int>(m_keys.size()); }
+
+    void Build(int count, const KeyFromIndexFunc& keyFromIndex);
+    void Build(std::vector<winrt::hstring>&& keys);
+    void Clear();
+
+    const std::vector<winrt::hstring>& Keys() const { return m_keys; }
+    const winrt::hstring& KeyFromIndex(int index) const;
+    // Returns -1 if no item has the key. Duplicate keys resolve to the first item.
+    int IndexFromKey(const winrt::hstring& key);
+
+    void OnItemsAdded(int index, int count, const KeyFromIndexFunc& keyFromIndex);
+    void OnItemsRemoved(int index, int count);
+    void OnItemsReplaced(int index, int count, const KeyFromIndexFunc& keyFromIndex);
+    void OnItemsMoved(int oldIndex, int newIndex, int count);
+
+private:
+    void EnsureIndices();
+
+    std::vector<winrt::hstring> m_keys;
+    std::unordered_map<winrt::hstring, int> m_indices;
+    bool m_isBuilt{ false };
+    bool m_areIndicesValid{ false };
+};
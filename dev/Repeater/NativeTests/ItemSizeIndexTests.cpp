@@ -0,0 +1,237 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+// Standalone tests for ItemSizeIndex. Random interleaved inserts, removes and measures are
+// checked against a plain vector of sizes, then the cost of single item inserts and removes
+// is measured on a million items. Only depends on the standard library, so it builds outside
+// of the MUXControls solution, for instance with
+//   g++ -std=c++17 -O2 ItemSizeIndexTests.cpp ../ItemSizeIndex.cpp
+//   cl /std:c++17 /EHsc /O2 ItemSizeIndexTests.cpp ..\ItemSizeIndex.cpp
+// The process exit code is the number of failed checks.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "../ItemSizeIndex.h"
+
+static int s_failedChecks = 0;
+
+static void Check(bool condition, const char* expression, int line)
+{
+    if (!condition)
+    {
+        std::printf("FAILED line %d: %s\n", line, expression);
+        s_failedChecks++;
+    }
+}
+
+#define CHECK(condition) Check((condition), #condition, __LINE__)
+#define CHECK_NEAR(actual, expected, tolerance) Check(std::abs((actual) - (expected)) <= (tolerance), #actual " ~= " #expected, __LINE__)
+
+static constexpr double s_estimatedSize{ 25.0 };
+static constexpr double s_spacing{ 4.0 };
+
+// Reference implementation: one entry per item, negative for unmeasured items.
+class ItemSizeModel
+{
+public:
+    int Count() const { return static_cast<int>(m_sizes.size()); }
+
+    int MeasuredCount() const
+    {
+        return static_cast<int>(std::count_if(m_sizes.begin(), m_sizes.end(), [](double size) { return size >= 0; }));
+    }
+
+    void SetSize(int index, double size) { m_sizes[index] = size; }
+    void Add(int index, int count) { m_sizes.insert(m_sizes.begin() + index, count, -1.0); }
+    void Remove(int index, int count) { m_sizes.erase(m_sizes.begin() + index, m_sizes.begin() + index + count); }
+
+    double GetOffset(int index) const
+    {
+        double offset = 0.0;
+        for (int i = 0; i < index; i++)
+        {
+            offset += (m_sizes[i] >= 0 ? m_sizes[i] : s_estimatedSize) + s_spacing;
+        }
+        return offset;
+    }
+
+private:
+    std::vector<double> m_sizes;
+};
+
+static void CheckAgainstModel(const ItemSizeIndex& index, const ItemSizeModel& model)
+{
+    CHECK(index.Count() == model.Count());
+    CHECK(index.MeasuredCount() == model.MeasuredCount());
+
+    double offset = 0.0;
+    for (int i = 0; i <= model.Count(); i++)
+    {
+        const double expectedOffset = model.GetOffset(i);
+        CHECK_NEAR(index.GetOffset(i, s_estimatedSize, s_spacing), expectedOffset, 1e-6);
+        if (i < model.Count())
+        {
+            // The start of an item and any offset inside of it map back to that item.
+            const double nextOffset = model.GetOffset(i + 1);
+            CHECK(index.GetIndexAt(expectedOffset, s_estimatedSize, s_spacing) == i);
+            CHECK(index.GetIndexAt((expectedOffset + nextOffset) / 2, s_estimatedSize, s_spacing) == i);
+        }
+        offset = expectedOffset;
+    }
+
+    CHECK_NEAR(index.GetTotalSize(s_estimatedSize, s_spacing), model.Count() > 0 ? offset - s_spacing : 0.0, 1e-6);
+    if (model.Count() > 0)
+    {
+        CHECK(index.GetIndexAt(-10.0, s_estimatedSize, s_spacing) == 0);
+        CHECK(index.GetIndexAt(offset + 10.0, s_estimatedSize, s_spacing) == model.Count() - 1);
+    }
+    else
+    {
+        CHECK(index.GetIndexAt(0.0, s_estimatedSize, s_spacing) == -1);
+    }
+}
+
+static void BasicTests()
+{
+    ItemSizeIndex index;
+    CHECK(index.Count() == 0);
+    CHECK(index.GetTotalSize(s_estimatedSize, s_spacing) == 0.0);
+
+    index.Resize(10);
+    CHECK(index.Count() == 10);
+    CHECK(index.MeasuredCount() == 0);
+    CHECK_NEAR(index.GetTotalSize(s_estimatedSize, s_spacing), 10 * s_estimatedSize + 9 * s_spacing, 1e-9);
+
+    index.SetSize(3, 100.0);
+    CHECK(index.MeasuredCount() == 1);
+    CHECK_NEAR(index.GetOffset(4, s_estimatedSize, s_spacing), 3 * s_estimatedSize + 100.0 + 4 * s_spacing, 1e-9);
+
+    // Measuring the same size again is a no-op, a new size replaces the old one.
+    index.SetSize(3, 100.0);
+    CHECK(index.MeasuredCount() == 1);
+    index.SetSize(3, 50.0);
+    CHECK(index.MeasuredCount() == 1);
+    CHECK_NEAR(index.GetOffset(4, s_estimatedSize, s_spacing), 3 * s_estimatedSize + 50.0 + 4 * s_spacing, 1e-9);
+
+    // Inserting before the measured item shifts it, removing it forgets its size.
+    index.OnItemsAdded(0, 2);
+    CHECK(index.Count() == 12);
+    CHECK_NEAR(index.GetOffset(6, s_estimatedSize, s_spacing), 5 * s_estimatedSize + 50.0 + 6 * s_spacing, 1e-9);
+    index.OnItemsRemoved(5, 1);
+    CHECK(index.Count() == 11);
+    CHECK(index.MeasuredCount() == 0);
+
+    // Changes reported before the first measure are clamped to what the index holds.
+    index.OnItemsAdded(100, 1);
+    CHECK(index.Count() == 12);
+    index.OnItemsRemoved(10, 100);
+    CHECK(index.Count() == 10);
+
+    index.Clear();
+    CHECK(index.Count() == 0);
+    CHECK(index.MeasuredCount() == 0);
+}
+
+static void InterleavedChangesTests()
+{
+    std::mt19937 random(1234);
+    ItemSizeIndex index;
+    ItemSizeModel model;
+
+    for (int step = 0; step < 4000; step++)
+    {
+        const int count = model.Count();
+        const int operation = std::uniform_int_distribution<int>(0, 9)(random);
+        if (operation < 4 && count > 0)
+        {
+            const int item = std::uniform_int_distribution<int>(0, count - 1)(random);
+            const double size = std::uniform_int_distribution<int>(0, 200)(random);
+            index.SetSize(item, size);
+            model.SetSize(item, size);
+        }
+        else if (operation < 7 || count == 0)
+        {
+            const int at = std::uniform_int_distribution<int>(0, count)(random);
+            const int added = std::uniform_int_distribution<int>(1, 8)(random);
+            index.OnItemsAdded(at, added);
+            model.Add(at, added);
+        }
+        else
+        {
+            const int at = std::uniform_int_distribution<int>(0, count - 1)(random);
+            const int removed = std::uniform_int_distribution<int>(1, std::min(6, count - at))(random);
+            index.OnItemsRemoved(at, removed);
+            model.Remove(at, removed);
+        }
+
+        if (step % 50 == 0)
+        {
+            CheckAgainstModel(index, model);
+        }
+    }
+
+    CheckAgainstModel(index, model);
+
+    // Shrinking and growing through Resize.
+    index.Resize(model.Count() / 2);
+    model.Remove(model.Count() / 2, model.Count() - model.Count() / 2);
+    CheckAgainstModel(index, model);
+    index.Resize(model.Count() + 20);
+    model.Add(model.Count(), 20);
+    CheckAgainstModel(index, model);
+}
+
+static void MillionItemsMeasurement()
+{
+    constexpr int itemCount = 1000000;
+    constexpr int operationCount = 20000;
+    std::mt19937 random(42);
+    ItemSizeIndex index;
+
+    auto start = std::chrono::steady_clock::now();
+    index.Resize(itemCount);
+    for (int i = 0; i < itemCount; i += 10)
+    {
+        index.SetSize(i, 10.0 + i % 90);
+    }
+    const double setupMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    double checksum = 0.0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < operationCount; i++)
+    {
+        const int at = std::uniform_int_distribution<int>(0, index.Count() - 1)(random);
+        if (i % 2 == 0)
+        {
+            index.OnItemsAdded(at, 1);
+            index.SetSize(at, 30.0);
+        }
+        else
+        {
+            index.OnItemsRemoved(at, 1);
+        }
+        checksum += index.GetOffset(at, s_estimatedSize, s_spacing);
+    }
+    const double changeMicroseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    CHECK(index.Count() == itemCount);
+    CHECK(checksum > 0.0);
+
+    std::printf("%d items, %d of them measured, set up in %.1f ms.\n", index.Count(), index.MeasuredCount(), setupMilliseconds);
+    std::printf("  single item insert or remove followed by an offset query: %.2f us\n", changeMicroseconds / operationCount);
+}
+
+int main()
+{
+    BasicTests();
+    InterleavedChangesTests();
+    MillionItemsMeasurement();
+
+    std::printf(s_failedChecks == 0 ? "All checks passed.\n" : "%d check(s) failed.\n", s_failedChecks);
+    return s_failedChecks;
+}
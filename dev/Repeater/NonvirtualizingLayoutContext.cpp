@@ -6,6 +6,7 @@
 #include "ItemsRepeater.common.h"
 #include "NonVirtualizingLayoutContext.h"
 #include "LayoutContextAdapter.h"
+#include <ppl.h>
 
 CppWinRTActivatableClassWithBasicFactory(NonVirtualizingLayoutContext);
 
@@ -16,8 +17,64 @@ winrt::IVectorView<winrt::UIElement> NonVirtualizingLayoutContext::Children()
     return overridable().ChildrenCore();
 }
 
+winrt::com_array<winrt::Rect> NonVirtualizingLayoutContext::ComputeChildBounds(winrt::LayoutGeometryCallback const& geometry)
+{
+    // Reading the desired sizes has to happen here on the UI thread. Everything after
+    // that only touches plain arrays and can run anywhere.
+    auto children = Children();
+    const int count = static_cast<int>(children.Size());
+    std::vector<winrt::Size> desiredSizes(count);
+    for (int i = 0; i < count; ++i)
+    {
+        desiredSizes[i] = children.GetAt(i).DesiredSize();
+    }
+
+    winrt::com_array<winrt::Rect> bounds(count);
+    const int workerCount = std::min(
+        static_cast<int>(concurrency::GetProcessorCount()),
+        count / s_minChildrenPerGeometryWorker);
+
+    // A callback that is not agile has to be called back on its own apartment. Calling it from
+    // a worker would marshal every chunk back to the UI thread, which is blocked in parallel_for
+    // waiting for those very chunks.
+    if (workerCount <= 1 || !IsAgile(geometry))
+    {
+        geometry(0, desiredSizes, bounds);
+    }
+    else
+    {
+        const int chunkSize = (count + workerCount - 1) / workerCount;
+        const winrt::Size* sizes = desiredSizes.data();
+        winrt::Rect* rects = bounds.data();
+
+        // Blocks until every chunk is done. Exceptions thrown by the callback
+        // are rethrown here.
+        concurrency::parallel_for(0, workerCount, [&geometry, sizes, rects, count, chunkSize](int chunk)
+        {
+            const int start = chunk * chunkSize;
+            const int end = std::min(start + chunkSize, count);
+            if (start < end)
+            {
+                geometry(
+                    start,
+                    winrt::array_view<const winrt::Size>(sizes + start, sizes + end),
+                    winrt::array_view<winrt::Rect>(rects + start, rects + end));
+            }
+        });
+    }
+
+    return bounds;
+}
+
 #pragma endregion
 
+/* static */
+bool NonVirtualizingLayoutContext::IsAgile(winrt::LayoutGeometryCallback const& geometry)
+{
+    winrt::com_ptr<::IAgileObject> agileObject;
+    return SUCCEEDED(winrt::get_unknown(geometry)->QueryInterface(__uuidof(::IAgileObject), agileObject.put_void()));
+}
+
 #pragma region INonVirtualizingLayoutContextOverrides
 
 winrt::IVectorView<winrt::UIElement> NonVirtualizingLayoutContext::ChildrenCore()
@@ -12,6 +12,7 @@ class NonVirtualizingLayoutContext :
 public:
 #pragma region INonVirtualizingLayoutContext
     winrt::IVectorView<winrt::UIElement> Children();
+    winrt::com_array<winrt::Rect> ComputeChildBounds(winrt::LayoutGeometryCallback const& geometry);
 #pragma endregion
 
 #pragma region INonVirtualizingLayoutContextOverrides
@@ -20,6 +21,12 @@ public:
 
     winrt::VirtualizingLayoutContext GetVirtualizingContextAdapter();
 
+    // Below this many children per worker, handing the geometry to the thread pool costs
+    // more than evaluating it on the UI thread.
+    static constexpr int s_minChildrenPerGeometryWorker = 4096;
+
 private:
+    static bool IsAgile(winrt::LayoutGeometryCallback const& geometry);
+
     winrt::VirtualizingLayoutContext m_contextAdapter{ nullptr };
 };
\ No newline at end of file
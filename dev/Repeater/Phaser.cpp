@@ -62,9 +62,7 @@ void Phaser::PhaseElement(
 
     if (shouldPhase)
     {
-        // Insert at the top since we remove from bottom during DoPhasedWorkCallback. This keeps the ordering of items
-        // the same as the order in which items are realized.
-        m_pendingElements.insert(m_pendingElements.begin(), ElementInfo(element, virtInfo));
+        m_incomingElements.emplace_back(element, virtInfo);
         RegisterForCallback();
     }
 }
@@ -73,13 +71,24 @@ void Phaser::StopPhasing(const winrt::UIElement& element, const winrt::com_ptr<V
 {
     // We need to remove the element from the pending elements list. We cannot just change the phase to -1
     // since it will get updated when the element gets recycled.
-    if (virtInfo->DataTemplateComponent())
+    // Elements that are done phasing have their phase set to PhaseReachedEnd, so there is nothing to remove.
+    const int phase = virtInfo->Phase();
+    if (virtInfo->DataTemplateComponent() && phase > 0 &&
+        !RemoveElement(m_incomingElements, element))
     {
-        auto it = std::find_if(m_pendingElements.begin(), m_pendingElements.end(), [&element](const ElementInfo& info) { return info.Element() == element; });
-
-        if (it != m_pendingElements.end())
+        // A pending element is waiting for its current phase, so only the buckets for that phase need to be searched.
+        for (int band = 0; band < s_bandCount; band++)
         {
-            m_pendingElements.erase(it);
+            auto it = m_buckets.find({ band, phase });
+            if (it != m_buckets.end() && RemoveElement(it->second, element))
+            {
+                if (it->second.empty())
+                {
+                    m_buckets.erase(it);
+                }
+
+                break;
+            }
         }
     }
 
@@ -91,17 +100,29 @@ void Phaser::DoPhasedWorkCallback()
 {
     MarkCallbackRecieved();
 
-    if (!m_pendingElements.empty() && !BuildTreeScheduler::ShouldYield())
+    // This runs on Rendering, ahead of the measure that would process buffered collection
+    // changes. Process them now so that elements whose items went away stop phasing.
+    m_owner->FlushPendingCollectionChanges();
+
+    if (HasPendingElements() && !BuildTreeScheduler::ShouldYield())
     {
-        const auto visibleWindow = m_owner->VisibleWindow();
-        SortElements(visibleWindow);
-        int currentIndex = static_cast<int>(m_pendingElements.size()) - 1;
-        do
+        UpdateBuckets(m_owner->VisibleWindow());
+
+        while (!m_buckets.empty())
         {
-            auto info = m_pendingElements[currentIndex];
+            // Buckets are ordered by (band, phase) so the first one holds the closest elements
+            // with the lowest phase.
+            auto bucket = m_buckets.begin();
+            const int band = bucket->first.first;
+            const auto info = bucket->second.back();
+            bucket->second.pop_back();
+            if (bucket->second.empty())
+            {
+                m_buckets.erase(bucket);
+            }
+
             auto element = info.Element();
             auto virtInfo = info.VirtInfo();
-            auto dataIndex = virtInfo->Index();
 
             int currentPhase = virtInfo->Phase();
             if (currentPhase > 0)
@@ -113,21 +134,10 @@ void Phaser::DoPhasedWorkCallback()
                 auto previousAvailableSize = winrt::LayoutInformation::GetAvailableSize(element);
                 element.Measure(previousAvailableSize);
 
+                virtInfo->Phase(nextPhase);
                 if (nextPhase > 0)
                 {
-                    virtInfo->Phase(nextPhase);
-                    // If we are the first item or 
-                    // If the current items phase is higher than the next items phase, then move to the next item.
-                    if (currentIndex == 0 ||
-                        virtInfo->Phase() > m_pendingElements[currentIndex - 1].VirtInfo()->Phase())
-                    {
-                        currentIndex--;
-                    }
-                }
-                else
-                {
-                    m_pendingElements.erase(m_pendingElements.begin() + currentIndex);
-                    currentIndex--;
+                    AddToBucket(info, band, nextPhase);
                 }
             }
             else
@@ -135,30 +145,14 @@ void Phaser::DoPhasedWorkCallback()
                 throw winrt::hresult_error(E_FAIL, L"Cleared element found in pending list which is not expected");
             }
 
-            auto pendingCount = static_cast<int>(m_pendingElements.size());
-            if (currentIndex == -1)
-            {
-                // Reached the top, start from the bottom again
-                currentIndex = pendingCount - 1;
-            }
-            else if (currentIndex > -1 && currentIndex < pendingCount - 1)
+            if (BuildTreeScheduler::ShouldYield())
             {
-                // If the next element is oustide the visible window and there are elements in the visible window
-                // go back to the visible window.
-                bool nextItemIsVisible = SharedHelpers::DoRectsIntersect(visibleWindow, m_pendingElements[currentIndex].VirtInfo()->ArrangeBounds());
-                if (!nextItemIsVisible)
-                {
-                    bool haveVisibleItems = SharedHelpers::DoRectsIntersect(visibleWindow, m_pendingElements[pendingCount - 1].VirtInfo()->ArrangeBounds());
-                    if (haveVisibleItems)
-                    {
-                        currentIndex = pendingCount - 1;
-                    }
-                }
+                break;
             }
-        } while (!m_pendingElements.empty() && !BuildTreeScheduler::ShouldYield());
+        }
     }
 
-    if (!m_pendingElements.empty())
+    if (HasPendingElements())
     {
         RegisterForCallback();
     }
@@ -168,10 +162,10 @@ void Phaser::RegisterForCallback()
 {
     if (!m_registeredForCallback)
     {
-        MUX_ASSERT(!m_pendingElements.empty());
+        MUX_ASSERT(HasPendingElements());
         m_registeredForCallback = true;
         BuildTreeScheduler::RegisterWork(
-            m_pendingElements[m_pendingElements.size() - 1].VirtInfo()->Phase(), // Use the phase of the last one in the sorted list
+            NextPhase(),
             [this]()
         {
             DoPhasedWorkCallback();
@@ -194,34 +188,93 @@ void Phaser::ValidatePhaseOrdering(int currentPhase, int nextPhase)
     }
 }
 
-void Phaser::SortElements(const winrt::Rect& visibleWindow)
+void Phaser::UpdateBuckets(const winrt::Rect& visibleWindow)
 {
-    // Sort in descending order (inVisibleWindow, phase)
-    std::sort(
-        m_pendingElements.begin(),
-        m_pendingElements.end(),
-        [visibleWindow](const auto& lhs, const auto& rhs)
+    if (visibleWindow != m_lastVisibleWindow)
     {
-        const auto lhsBounds = lhs.VirtInfo()->ArrangeBounds();
-        const auto lhsIntersects = SharedHelpers::DoRectsIntersect(lhsBounds, visibleWindow);
-        const auto rhsBounds = rhs.VirtInfo()->ArrangeBounds();
-        const auto rhsIntersects = SharedHelpers::DoRectsIntersect(rhsBounds, visibleWindow);
-
-        if ((lhsIntersects && rhsIntersects) ||
-            (!lhsIntersects && !rhsIntersects))
-        {
-            // Both are in the visible window or both are not
-            return lhs.VirtInfo()->Phase() < rhs.VirtInfo()->Phase();
-        }
-        else if (lhsIntersects)
-        {
-            // Left is in visible window
-            return false;
-        }
-        else
+        // Only elements that crossed into a different band need to move.
+        m_lastVisibleWindow = visibleWindow;
+        for (auto it = m_buckets.begin(); it != m_buckets.end();)
         {
-            return true;
+            const int band = it->first.first;
+            const int phase = it->first.second;
+            auto& elements = it->second;
+            for (size_t i = 0; i < elements.size();)
+            {
+                const int newBand = GetBand(elements[i].VirtInfo()->ArrangeBounds(), visibleWindow);
+                if (newBand != band)
+                {
+                    AddToBucket(elements[i], newBand, phase);
+                    elements[i] = elements.back();
+                    elements.pop_back();
+                }
+                else
+                {
+                    i++;
+                }
+            }
+
+            it = elements.empty() ? m_buckets.erase(it) : std::next(it);
         }
     }
-    );
-}
\ No newline at end of file
+
+    // Add the new elements in reverse so that elements in the same bucket
+    // are phased in the order in which they were realized.
+    for (auto it = m_incomingElements.rbegin(); it != m_incomingElements.rend(); ++it)
+    {
+        AddToBucket(*it, GetBand(it->VirtInfo()->ArrangeBounds(), visibleWindow), it->VirtInfo()->Phase());
+    }
+
+    m_incomingElements.clear();
+}
+
+void Phaser::AddToBucket(const ElementInfo& info, int band, int phase)
+{
+    m_buckets[{ band, phase }].push_back(info);
+}
+
+int Phaser::NextPhase() const
+{
+    return !m_buckets.empty() ?
+        m_buckets.begin()->first.second :
+        m_incomingElements.back().VirtInfo()->Phase();
+}
+
+/* static */
+bool Phaser::RemoveElement(std::vector<ElementInfo>& elements, const winrt::UIElement& element)
+{
+    auto it = std::find_if(elements.begin(), elements.end(), [&element](const ElementInfo& info) { return info.Element() == element; });
+    if (it != elements.end())
+    {
+        elements.erase(it);
+        return true;
+    }
+
+    return false;
+}
+
+/* static */
+int Phaser::GetBand(const winrt::Rect& bounds, const winrt::Rect& visibleWindow)
+{
+    if (bounds == ItemsRepeater::InvalidRect)
+    {
+        // Not arranged yet, phase it after everything we know the position of.
+        return s_bandCount - 1;
+    }
+
+    if (SharedHelpers::DoRectsIntersect(bounds, visibleWindow))
+    {
+        return 0;
+    }
+
+    const float viewportSize = std::max(visibleWindow.Width, visibleWindow.Height);
+    if (viewportSize <= 0)
+    {
+        return s_bandCount - 1;
+    }
+
+    const float distanceX = std::max({ 0.0f, visibleWindow.X - (bounds.X + bounds.Width), bounds.X - (visibleWindow.X + visibleWindow.Width) });
+    const float distanceY = std::max({ 0.0f, visibleWindow.Y - (bounds.Y + bounds.Height), bounds.Y - (visibleWindow.Y + visibleWindow.Height) });
+    const int band = 1 + static_cast<int>(std::max(distanceX, distanceY) / viewportSize);
+    return std::min(band, s_bandCount - 1);
+}
@@ -27,13 +27,28 @@ public:
     void StopPhasing(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo);
 
 private:
+    // Pending elements are bucketed by their distance to the visible window (in
+    // viewports, 0 being visible) and then by the next phase they need to run.
+    using BucketKey = std::pair<int /* band */, int /* phase */>;
+
     void DoPhasedWorkCallback();
     void RegisterForCallback();
     void MarkCallbackRecieved();
-    void SortElements(const winrt::Rect& visibleWindow);
+    void UpdateBuckets(const winrt::Rect& visibleWindow);
+    void AddToBucket(const ElementInfo& info, int band, int phase);
+    bool HasPendingElements() const { return !m_buckets.empty() || !m_incomingElements.empty(); }
+    int NextPhase() const;
+    static bool RemoveElement(std::vector<ElementInfo>& elements, const winrt::UIElement& element);
+    static int GetBand(const winrt::Rect& bounds, const winrt::Rect& visibleWindow);
     static void ValidatePhaseOrdering(int currentPhase, int nextPhase);
 
     ItemsRepeater* m_owner{ nullptr };
-    std::vector<ElementInfo> m_pendingElements{};
+    // Elements queued since the last callback. They are not arranged yet, so they
+    // get bucketed when the callback runs.
+    std::vector<ElementInfo> m_incomingElements{};
+    std::map<BucketKey, std::vector<ElementInfo>> m_buckets{};
+    winrt::Rect m_lastVisibleWindow{};
     bool m_registeredForCallback{ false };
+
+    static constexpr int s_bandCount = 4;
 };
\ No newline at end of file
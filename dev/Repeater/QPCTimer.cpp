@@ -20,15 +20,20 @@ void QPCTimer::Reset()
 }
 
 int QPCTimer::DurationInMilliSeconds() const
+{
+    return static_cast<int>(PreciseDurationInMilliSeconds());
+}
+
+double QPCTimer::PreciseDurationInMilliSeconds() const
 {
     LARGE_INTEGER now;
     auto success = QueryPerformanceCounter(&now);
-    int elapsedMilliSeconds = 0;
+    double elapsedMilliSeconds = 0.0;
 
     if (success)
     {
         double elapsedSeconds = static_cast<DOUBLE>(now.QuadPart - m_start.QuadPart) / static_cast<DOUBLE>(m_frequency.QuadPart);
-        elapsedMilliSeconds = static_cast<int>(elapsedSeconds * 1000);
+        elapsedMilliSeconds = elapsedSeconds * 1000;
     }
     else
     {
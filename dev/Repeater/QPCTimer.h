@@ -10,6 +10,7 @@ public:
     QPCTimer();
     void Reset();
     int DurationInMilliSeconds() const;
+    double PreciseDurationInMilliSeconds() const;
 
 private:
     LARGE_INTEGER m_start;
@@ -0,0 +1,237 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include <pch.h>
+#include <common.h>
+#include "RealizedElementStore.h"
+
+winrt::UIElement RealizedElementStore::GetElement(int index) const
+{
+    MUX_ASSERT(index >= 0 && index < m_size);
+    return m_elements[PhysicalIndex(index)].get();
+}
+
+void RealizedElementStore::SetElement(int index, const winrt::UIElement& element)
+{
+    MUX_ASSERT(index >= 0 && index < m_size);
+    m_elements[PhysicalIndex(index)].set(element);
+}
+
+winrt::Rect RealizedElementStore::GetBounds(int index) const
+{
+    MUX_ASSERT(index >= 0 && index < m_size);
+    const int i = PhysicalIndex(index);
+    return winrt::Rect{ m_x[i], m_y[i], m_width[i], m_height[i] };
+}
+
+void RealizedElementStore::SetBounds(int index, const winrt::Rect& bounds)
+{
+    MUX_ASSERT(index >= 0 && index < m_size);
+    const int i = PhysicalIndex(index);
+    m_x[i] = bounds.X;
+    m_y[i] = bounds.Y;
+    m_width[i] = bounds.Width;
+    m_height[i] = bounds.Height;
+}
+
+void RealizedElementStore::PushBack(const winrt::UIElement& element, const winrt::Rect& bounds)
+{
+    EnsureCapacity(m_size + 1);
+    m_size++;
+    SetElement(m_size - 1, element);
+    SetBounds(m_size - 1, bounds);
+}
+
+void RealizedElementStore::PushFront(const winrt::UIElement& element, const winrt::Rect& bounds)
+{
+    EnsureCapacity(m_size + 1);
+    m_head = (m_head - 1) & (Capacity() - 1);
+    m_size++;
+    SetElement(0, element);
+    SetBounds(0, bounds);
+}
+
+void RealizedElementStore::Insert(int index, const winrt::UIElement& element, const winrt::Rect& bounds)
+{
+    MUX_ASSERT(index >= 0 && index <= m_size);
+    if (index == 0)
+    {
+        PushFront(element, bounds);
+    }
+    else if (index == m_size)
+    {
+        PushBack(element, bounds);
+    }
+    else
+    {
+        // Inserting in the middle only happens on collection changes.
+        EnsureCapacity(m_size + 1);
+        m_size++;
+        for (int i = m_size - 1; i > index; --i)
+        {
+            MoveSlot(i - 1, i);
+        }
+
+        SetElement(index, element);
+        SetBounds(index, bounds);
+    }
+}
+
+void RealizedElementStore::Erase(int index, int count)
+{
+    MUX_ASSERT(index >= 0 && count >= 0 && index + count <= m_size);
+    if (index == 0)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            ClearSlot(i);
+        }
+
+        m_head = m_size == count ? 0 : PhysicalIndex(count);
+    }
+    else
+    {
+        // Removing from the middle only happens on collection changes, shift the tail down.
+        for (int i = index + count; i < m_size; ++i)
+        {
+            MoveSlot(i, i - count);
+        }
+
+        for (int i = m_size - count; i < m_size; ++i)
+        {
+            ClearSlot(i);
+        }
+    }
+
+    m_size -= count;
+}
+
+void RealizedElementStore::Resize(int size)
+{
+    if (size < m_size)
+    {
+        Erase(size, m_size - size);
+    }
+    else if (size > m_size)
+    {
+        EnsureCapacity(size);
+        const int oldSize = m_size;
+        m_size = size;
+        for (int i = oldSize; i < size; ++i)
+        {
+            SetBounds(i, winrt::Rect());
+        }
+    }
+}
+
+void RealizedElementStore::Clear()
+{
+    Erase(0, m_size);
+}
+
+int RealizedElementStore::IndexOf(const winrt::UIElement& element) const
+{
+    for (int i = 0; i < m_size; ++i)
+    {
+        if (m_elements[PhysicalIndex(i)] == element)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+int RealizedElementStore::CountOutsideFromFront(float windowStart, float windowEnd, ScrollOrientation orientation) const
+{
+    const bool isVertical = orientation == ScrollOrientation::Vertical;
+    const float* starts = isVertical ? m_y.data() : m_x.data();
+    const float* sizes = isVertical ? m_height.data() : m_width.data();
+
+    int count = 0;
+    while (count < m_size && !Intersects(starts, sizes, PhysicalIndex(count), windowStart, windowEnd))
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+int RealizedElementStore::CountOutsideFromBack(float windowStart, float windowEnd, ScrollOrientation orientation) const
+{
+    const bool isVertical = orientation == ScrollOrientation::Vertical;
+    const float* starts = isVertical ? m_y.data() : m_x.data();
+    const float* sizes = isVertical ? m_height.data() : m_width.data();
+
+    int count = 0;
+    while (count < m_size && !Intersects(starts, sizes, PhysicalIndex(m_size - 1 - count), windowStart, windowEnd))
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+void RealizedElementStore::EnsureCapacity(int size)
+{
+    if (size > Capacity())
+    {
+        int capacity = std::max(s_minCapacity, Capacity());
+        while (capacity < size)
+        {
+            capacity *= 2;
+        }
+
+        std::vector<tracker_ref<winrt::UIElement>> elements;
+        elements.reserve(capacity);
+        std::vector<float> x(capacity);
+        std::vector<float> y(capacity);
+        std::vector<float> width(capacity);
+        std::vector<float> height(capacity);
+        for (int i = 0; i < m_size; ++i)
+        {
+            const int from = PhysicalIndex(i);
+            elements.emplace_back(std::move(m_elements[from]));
+            x[i] = m_x[from];
+            y[i] = m_y[from];
+            width[i] = m_width[from];
+            height[i] = m_height[from];
+        }
+
+        while (static_cast<int>(elements.size()) < capacity)
+        {
+            elements.emplace_back(m_owner);
+        }
+
+        m_elements = std::move(elements);
+        m_x = std::move(x);
+        m_y = std::move(y);
+        m_width = std::move(width);
+        m_height = std::move(height);
+        m_head = 0;
+    }
+}
+
+void RealizedElementStore::MoveSlot(int fromIndex, int toIndex)
+{
+    const int from = PhysicalIndex(fromIndex);
+    const int to = PhysicalIndex(toIndex);
+    m_elements[to].set(m_elements[from].get());
+    m_x[to] = m_x[from];
+    m_y[to] = m_y[from];
+    m_width[to] = m_width[from];
+    m_height[to] = m_height[from];
+}
+
+void RealizedElementStore::ClearSlot(int index)
+{
+    // Keep the tracker handle around for the next element that lands in this slot.
+    m_elements[PhysicalIndex(index)].set(nullptr);
+}
+
+/* static */
+bool RealizedElementStore::Intersects(const float* starts, const float* sizes, int physicalIndex, float windowStart, float windowEnd)
+{
+    const float start = starts[physicalIndex];
+    return windowEnd >= start && windowStart <= start + sizes[physicalIndex];
+}
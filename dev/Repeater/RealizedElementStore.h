@@ -0,0 +1,64 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "OrientationBasedMeasures.h"
+
+// Storage for the realized range of ElementManager. Elements and their layout bounds
+// live in a ring buffer so that the range can grow and shrink at both ends in O(1) as
+// the window slides. Slots keep their tracker handles when they are emptied, so elements
+// coming and going do not allocate new handles every time.
+// Bounds are stored as separate X, Y, Width and Height columns so that the window
+// intersection scans only walk the two contiguous columns of the scrolling direction.
+class RealizedElementStore final
+{
+public:
+    RealizedElementStore(const ITrackerHandleManager* owner) : m_owner(owner) { }
+
+    int Size() const { return m_size; }
+
+    winrt::UIElement GetElement(int index) const;
+    void SetElement(int index, const winrt::UIElement& element);
+    winrt::Rect GetBounds(int index) const;
+    void SetBounds(int index, const winrt::Rect& bounds);
+
+    void PushBack(const winrt::UIElement& element, const winrt::Rect& bounds);
+    void PushFront(const winrt::UIElement& element, const winrt::Rect& bounds);
+    void Insert(int index, const winrt::UIElement& element, const winrt::Rect& bounds);
+    void Erase(int index, int count);
+    void Resize(int size);
+    void Clear();
+
+    int IndexOf(const winrt::UIElement& element) const;
+
+    // Number of consecutive items, starting from the front (or the back), whose
+    // bounds do not intersect [windowStart, windowEnd] in the given orientation.
+    int CountOutsideFromFront(float windowStart, float windowEnd, ScrollOrientation orientation) const;
+    int CountOutsideFromBack(float windowStart, float windowEnd, ScrollOrientation orientation) const;
+
+    // we do not want copies of this type
+    RealizedElementStore(const RealizedElementStore& that) = delete;
+    RealizedElementStore& operator=(const RealizedElementStore& other) = delete;
+
+private:
+    int Capacity() const { return static_cast<int>(m_elements.size()); }
+    // Capacity is always a power of two so wrapping around is a mask.
+    int PhysicalIndex(int index) const { return (m_head + index) & (Capacity() - 1); }
+    void EnsureCapacity(int size);
+    void MoveSlot(int fromIndex, int toIndex);
+    void ClearSlot(int index);
+    static bool Intersects(const float* starts, const float* sizes, int physicalIndex, float windowStart, float windowEnd);
+
+    const ITrackerHandleManager* m_owner;
+
+    std::vector<tracker_ref<winrt::UIElement>> m_elements;
+    std::vector<float> m_x;
+    std::vector<float> m_y;
+    std::vector<float> m_width;
+    std::vector<float> m_height;
+    int m_head{};
+    int m_size{};
+
+    static constexpr int s_minCapacity = 16;
+};
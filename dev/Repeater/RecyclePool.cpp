@@ -38,6 +38,24 @@ winrt::UIElement RecyclePool::TryGetElement(
 
 #pragma endregion
 
+#pragma region IRecyclePool (Preview)
+
+int RecyclePool::MaxElementsPerKey()
+{
+    return m_maxElementsPerKey;
+}
+
+void RecyclePool::MaxElementsPerKey(int value)
+{
+    m_maxElementsPerKey = value;
+    for (auto& entry : m_elements)
+    {
+        TrimToMaxElements(entry.second);
+    }
+}
+
+#pragma endregion
+
 #pragma region IRecyclePoolOverrides
 
 void RecyclePool::PutElementCore(
@@ -45,84 +63,257 @@ void RecyclePool::PutElementCore(
     winrt::hstring const& key,
     winrt::UIElement const& owner)
 {
+    auto winrtOwnerAsPanel = EnsureOwnerIsPanelOrNull(owner);
 
-    const auto winrtKey = key;
-    auto iterator = m_elements.find(winrtKey);
-    auto winrtOwner = owner;
-    auto winrtOwnerAsPanel = EnsureOwnerIsPanelOrNull(winrtOwner);
-
-    ElementInfo elementInfo{ this /* refManager */, element, winrtOwnerAsPanel };
+    auto& pool = GetPool(key);
+    AddElement(pool, GetOrCreateBucket(pool, winrtOwnerAsPanel), element);
+    TrimToMaxElements(pool);
+}
 
-    if (iterator != m_elements.end())
+winrt::UIElement RecyclePool::TryGetElementCore(
+    winrt::hstring const& key,
+    winrt::UIElement const& owner)
+{
+    auto pool = TryGetPool(key);
+    if (pool && pool->m_count > 0)
     {
-        iterator->second.emplace_back(std::move(elementInfo));
+        auto ownerAsPanel = EnsureOwnerIsPanelOrNull(owner);
+
+        // Prefer an element from the same owner or with no owner so that we don't incur
+        // the enter/leave cost during recycling. Otherwise take the most recently
+        // recycled element from any other owner.
+        auto bucket = FindBucketForOwner(*pool, ownerAsPanel);
+        if (bucket == pool->m_buckets.end() && ownerAsPanel)
+        {
+            bucket = FindBucketForOwner(*pool, nullptr);
+        }
+
+        if (bucket == pool->m_buckets.end())
+        {
+            bucket = pool->m_slots[pool->m_newest].m_bucket;
+        }
+
+        const int slot = bucket->m_newest;
+        MUX_ASSERT(slot != s_noElement);
+        const auto element = pool->m_slots[slot].m_element.get();
+        const auto elementOwner = bucket->Owner();
+        RemoveElement(*pool, slot);
+
+        if (elementOwner && elementOwner != ownerAsPanel)
+        {
+            // Element is still under its parent. remove it from its parent.
+            if (!RemoveFromOwner(elementOwner, element))
+            {
+                throw winrt::hresult_error(E_FAIL, L"ItemsRepeater's child not found in its Children collection.");
+            }
+        }
+
+        ++m_hitCount;
+        return element;
     }
-    else
+
+    ++m_missCount;
+    return nullptr;
+}
+
+#pragma endregion
+
+RecyclePool::KeyPool& RecyclePool::GetPool(const winrt::hstring& key)
+{
+    if (auto pool = TryGetPool(key))
     {
-        std::vector<ElementInfo> pool;
-        pool.emplace_back(elementInfo);
-        m_elements.emplace(winrtKey, std::move(pool));
+        return *pool;
     }
+
+    auto& pool = m_elements[key];
+    m_lastKey = key;
+    m_lastPool = &pool;
+    return pool;
 }
 
-winrt::UIElement RecyclePool::TryGetElementCore(
-    winrt::hstring const& key,
-    winrt::UIElement const& owner)
+RecyclePool::KeyPool* RecyclePool::TryGetPool(const winrt::hstring& key)
 {
+    if (m_lastPool && winrt::get_abi(key) == winrt::get_abi(m_lastKey))
+    {
+        return m_lastPool;
+    }
+
     auto iterator = m_elements.find(key);
-    if (iterator != m_elements.end())
+    if (iterator == m_elements.end())
+    {
+        return nullptr;
+    }
+
+    m_lastKey = key;
+    m_lastPool = &iterator->second;
+    return m_lastPool;
+}
+
+RecyclePool::OwnerBucketIterator RecyclePool::GetOrCreateBucket(KeyPool& pool, const winrt::Panel& owner)
+{
+    auto bucket = FindBucketForOwner(pool, owner);
+    if (bucket == pool.m_buckets.end())
     {
-        auto& elements = iterator->second;
-        if (elements.size() > 0)
+        pool.m_buckets.emplace_back(this /* refManager */, owner);
+        bucket = std::prev(pool.m_buckets.end());
+    }
+
+    return bucket;
+}
+
+RecyclePool::OwnerBucketIterator RecyclePool::FindBucketForOwner(KeyPool& pool, const winrt::Panel& owner)
+{
+    for (auto bucket = pool.m_buckets.begin(); bucket != pool.m_buckets.end(); ++bucket)
+    {
+        if (bucket->Owner() == owner)
         {
-            ElementInfo elementInfo{ this /* refManager */, nullptr, nullptr };
-            // Prefer an element from the same owner or with no owner so that we don't incur
-            // the enter/leave cost during recycling.
-            // TODO: prioritize elements with the same owner to those without an owner.
-            const auto winrtOwner = owner;
-            auto iter = std::find_if(
-                elements.begin(),
-                elements.end(),
-                [&winrtOwner](const ElementInfo& elemInfo) { return elemInfo.Owner() == winrtOwner || !elemInfo.Owner(); });
-
-            if (iter != elements.end())
-            {
-                elementInfo = *iter;
-                elements.erase(iter);
-            }
-            else
-            {
-                elementInfo = elements.back();
-                elements.pop_back();
-            }
+            return bucket;
+        }
+    }
 
-            auto ownerAsPanel = EnsureOwnerIsPanelOrNull(winrtOwner);
-            if (elementInfo.Owner() && elementInfo.Owner() != ownerAsPanel)
-            {
-                // Element is still under its parent. remove it from its parent.
-                auto panel = elementInfo.Owner();
-                if (panel)
-                {
-                    unsigned int childIndex = 0;
-                    bool found = panel.Children().IndexOf(elementInfo.Element(), childIndex);
-                    if (!found)
-                    {
-                        throw winrt::hresult_error(E_FAIL, L"ItemsRepeater's child not found in its Children collection.");
-                    }
-
-                    panel.Children().RemoveAt(childIndex);
-                }
-            }
+    return pool.m_buckets.end();
+}
 
-            return elementInfo.Element();
+void RecyclePool::AddElement(KeyPool& pool, OwnerBucketIterator bucket, const winrt::UIElement& element)
+{
+    int slot;
+    if (!pool.m_freeSlots.empty())
+    {
+        slot = pool.m_freeSlots.back();
+        pool.m_freeSlots.pop_back();
+    }
+    else
+    {
+        slot = static_cast<int>(pool.m_slots.size());
+        pool.m_slots.emplace_back(this /* refManager */);
+    }
+
+    auto& pooled = pool.m_slots[slot];
+    pooled.m_element.set(element);
+    pooled.m_bucket = bucket;
+
+    // Link as the newest element of the key and of the bucket.
+    pooled.m_newer = s_noElement;
+    pooled.m_older = pool.m_newest;
+    if (pool.m_newest != s_noElement)
+    {
+        pool.m_slots[pool.m_newest].m_newer = slot;
+    }
+    else
+    {
+        pool.m_oldest = slot;
+    }
+    pool.m_newest = slot;
+
+    pooled.m_newerInBucket = s_noElement;
+    pooled.m_olderInBucket = bucket->m_newest;
+    if (bucket->m_newest != s_noElement)
+    {
+        pool.m_slots[bucket->m_newest].m_newerInBucket = slot;
+    }
+    else
+    {
+        bucket->m_oldest = slot;
+    }
+    bucket->m_newest = slot;
+
+    ++pool.m_count;
+}
+
+void RecyclePool::RemoveElement(KeyPool& pool, int slot)
+{
+    auto& pooled = pool.m_slots[slot];
+    const auto bucket = pooled.m_bucket;
+
+    if (pooled.m_older != s_noElement)
+    {
+        pool.m_slots[pooled.m_older].m_newer = pooled.m_newer;
+    }
+    else
+    {
+        pool.m_oldest = pooled.m_newer;
+    }
+
+    if (pooled.m_newer != s_noElement)
+    {
+        pool.m_slots[pooled.m_newer].m_older = pooled.m_older;
+    }
+    else
+    {
+        pool.m_newest = pooled.m_older;
+    }
+
+    if (pooled.m_olderInBucket != s_noElement)
+    {
+        pool.m_slots[pooled.m_olderInBucket].m_newerInBucket = pooled.m_newerInBucket;
+    }
+    else
+    {
+        bucket->m_oldest = pooled.m_newerInBucket;
+    }
+
+    if (pooled.m_newerInBucket != s_noElement)
+    {
+        pool.m_slots[pooled.m_newerInBucket].m_olderInBucket = pooled.m_olderInBucket;
+    }
+    else
+    {
+        bucket->m_newest = pooled.m_olderInBucket;
+    }
+
+    pooled.m_element.set(nullptr);
+    pooled.m_bucket = {};
+    pool.m_freeSlots.push_back(slot);
+    --pool.m_count;
+
+    if (bucket->m_newest == s_noElement)
+    {
+        // Do not hold on to owners that no longer have recycled elements in this pool.
+        pool.m_buckets.erase(bucket);
+    }
+}
+
+void RecyclePool::TrimToMaxElements(KeyPool& pool)
+{
+    if (m_maxElementsPerKey >= 0)
+    {
+        while (pool.m_count > m_maxElementsPerKey)
+        {
+            EvictOldest(pool);
         }
     }
+}
 
-    return nullptr;
+void RecyclePool::EvictOldest(KeyPool& pool)
+{
+    const int slot = pool.m_oldest;
+    MUX_ASSERT(slot != s_noElement);
+    const auto element = pool.m_slots[slot].m_element.get();
+    const auto owner = pool.m_slots[slot].m_bucket->Owner();
+    RemoveElement(pool, slot);
+
+    // The element is no longer going to be reused, so make sure the owner
+    // does not keep it alive either. It might have been moved out already.
+    if (owner)
+    {
+        RemoveFromOwner(owner, element);
+    }
+
+    ++m_evictionCount;
 }
 
+/* static */
+bool RecyclePool::RemoveFromOwner(const winrt::Panel& owner, const winrt::UIElement& element)
+{
+    unsigned int childIndex = 0;
+    bool found = owner.Children().IndexOf(element, childIndex);
+    if (found)
+    {
+        owner.Children().RemoveAt(childIndex);
+    }
 
-#pragma endregion
+    return found;
+}
 
 winrt::Panel RecyclePool::EnsureOwnerIsPanelOrNull(const winrt::UIElement& owner)
 {
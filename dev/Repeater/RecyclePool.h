@@ -24,6 +24,15 @@ public:
         winrt::UIElement const& owner);
 #pragma endregion
 
+#pragma region IRecyclePool (Preview)
+    int MaxElementsPerKey();
+    void MaxElementsPerKey(int value);
+
+    uint64_t HitCount() { return m_hitCount; }
+    uint64_t MissCount() { return m_missCount; }
+    uint64_t EvictionCount() { return m_evictionCount; }
+#pragma endregion
+
 #pragma region IRecyclePoolOverrides
     void PutElementCore(
         winrt::UIElement const& element,
@@ -57,18 +66,81 @@ private:
 
     winrt::Panel EnsureOwnerIsPanelOrNull(const winrt::UIElement& owner);
 
-    struct ElementInfo
+    static constexpr int s_noElement = -1;
+
+    // Elements recycled under the same key by the same owner, linked from the
+    // most recently recycled one through m_olderInBucket. Elements are taken
+    // from the newest end (LIFO) and evicted from the oldest end (LRU).
+    struct OwnerBucket
     {
-        ElementInfo(const ITrackerHandleManager* refManager, const winrt::UIElement& element, const winrt::Panel& owner)
-            :m_element(refManager, element), m_owner(refManager, owner) {}
+        OwnerBucket(const ITrackerHandleManager* refManager, const winrt::Panel& owner)
+            :m_owner(refManager, owner) {}
 
-        winrt::UIElement Element() const { return m_element.get(); };
         winrt::Panel Owner() const { return m_owner.get(); };
 
+        int m_newest{ s_noElement };
+        int m_oldest{ s_noElement };
+
     private:
-        tracker_ref<winrt::UIElement> m_element;
         tracker_ref<winrt::Panel> m_owner;
     };
 
-    std::map<winrt::hstring /*key*/, std::vector<ElementInfo>> m_elements;
+    using OwnerBucketIterator = std::list<OwnerBucket>::iterator;
+
+    // A recycled element. It is linked both into the list of every element of its key
+    // in put order, which gives the least recently recycled element in O(1), and into
+    // the list of its owner bucket.
+    struct PooledElement
+    {
+        PooledElement(const ITrackerHandleManager* refManager)
+            :m_element(refManager) {}
+
+        tracker_ref<winrt::UIElement> m_element;
+        OwnerBucketIterator m_bucket{};
+        int m_older{ s_noElement };
+        int m_newer{ s_noElement };
+        int m_olderInBucket{ s_noElement };
+        int m_newerInBucket{ s_noElement };
+    };
+
+    // All the elements for a key. Slots of m_slots are reused through m_freeSlots
+    // so that recycling does not allocate once the pool has warmed up. There are
+    // usually only one or two owners sharing a pool, so finding the bucket of an
+    // owner is a short walk; buckets are kept in a list so that elements can point
+    // back at theirs.
+    struct KeyPool
+    {
+        std::vector<PooledElement> m_slots;
+        std::vector<int> m_freeSlots;
+        std::list<OwnerBucket> m_buckets;
+        int m_newest{ s_noElement };
+        int m_oldest{ s_noElement };
+        int m_count{};
+    };
+
+    KeyPool& GetPool(const winrt::hstring& key);
+    KeyPool* TryGetPool(const winrt::hstring& key);
+    OwnerBucketIterator GetOrCreateBucket(KeyPool& pool, const winrt::Panel& owner);
+    OwnerBucketIterator FindBucketForOwner(KeyPool& pool, const winrt::Panel& owner);
+    void AddElement(KeyPool& pool, OwnerBucketIterator bucket, const winrt::UIElement& element);
+    void RemoveElement(KeyPool& pool, int slot);
+    void TrimToMaxElements(KeyPool& pool);
+    void EvictOldest(KeyPool& pool);
+    static bool RemoveFromOwner(const winrt::Panel& owner, const winrt::UIElement& element);
+
+    std::unordered_map<winrt::hstring /*key*/, KeyPool> m_elements;
+
+    // Callers usually pass the same HSTRING for a key every time (the key of a template
+    // or the boxed ReuseKey of an element), so the pool of the last key is looked up by
+    // comparing handles before falling back to hashing the key. Pools are never removed
+    // from m_elements and unordered_map does not move its elements, so the pointer stays
+    // valid.
+    winrt::hstring m_lastKey{};
+    KeyPool* m_lastPool{ nullptr };
+
+    // Negative means there is no limit on the number of elements kept per key.
+    int m_maxElementsPerKey{ -1 };
+    uint64_t m_hitCount{};
+    uint64_t m_missCount{};
+    uint64_t m_evictionCount{};
 };
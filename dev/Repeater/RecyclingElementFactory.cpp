@@ -9,6 +9,9 @@
 #include "RecyclingElementFactory.h"
 #include "ItemsRepeater.h"
 #include "RecyclePool.h"
+#include "QPCTimer.h"
+#include "BuildTreeScheduler.h"
+#include "RepeaterTrace.h"
 
 CppWinRTActivatableClassWithBasicFactory(RecyclingElementFactory);
 
@@ -51,6 +54,46 @@ void RecyclingElementFactory::SelectTemplateKey(winrt::event_token const& token)
 
 #pragma endregion
 
+#pragma region IRecyclingElementFactory (Preview)
+
+void RecyclingElementFactory::Prewarm(winrt::hstring const& key, int count)
+{
+    if (count < 0)
+    {
+        throw winrt::hresult_invalid_argument(L"Count cannot be negative.");
+    }
+
+    if (!m_recyclePool)
+    {
+        throw winrt::hresult_error(E_FAIL, L"RecyclePool property cannot be null.");
+    }
+
+    if (!m_templates || !m_templates.get().HasKey(key))
+    {
+        std::wstring message = L"No templates of key " + std::wstring(key.data()) + L" were found in the templates collection.";
+        throw winrt::hresult_error(E_FAIL, message.c_str());
+    }
+
+    if (count > 0)
+    {
+        m_pendingPrewarm.emplace_back(key, count);
+        RegisterForPrewarm();
+    }
+}
+
+winrt::RecyclingElementFactoryTemplateStatistics RecyclingElementFactory::GetTemplateStatistics(winrt::hstring const& key)
+{
+    auto iterator = m_templateStatistics.find(key);
+    return iterator != m_templateStatistics.end() ? iterator->second : winrt::RecyclingElementFactoryTemplateStatistics{};
+}
+
+void RecyclingElementFactory::ResetTemplateStatistics()
+{
+    m_templateStatistics.clear();
+}
+
+#pragma endregion
+
 #pragma region IRecyclingElementFactoryOverrides
 
 winrt::hstring RecyclingElementFactory::OnSelectTemplateKeyCore(
@@ -106,7 +149,11 @@ winrt::UIElement RecyclingElementFactory::GetElementCore(winrt::ElementFactoryGe
     // Get an element from the Recycle Pool or create one
     auto element = safe_cast<winrt::FrameworkElement>(m_recyclePool.get().TryGetElement(templateKey, winrtOwner));
 
-    if (!element)
+    if (element)
+    {
+        ++m_templateStatistics[templateKey].HitCount;
+    }
+    else
     {
         // No need to call HasKey if there is only one template.
         if (m_templates.get().Size() > 1 && !m_templates.get().HasKey(templateKey))
@@ -115,11 +162,8 @@ winrt::UIElement RecyclingElementFactory::GetElementCore(winrt::ElementFactoryGe
             throw winrt::hresult_error(E_FAIL, message.c_str());
         }
 
-        auto dataTemplate = m_templates.get().Lookup(templateKey);
-        element = dataTemplate.LoadContent().as<winrt::FrameworkElement>();
-
-        // Associate ReuseKey with element
-        RecyclePool::SetReuseKey(element, templateKey);
+        ++m_templateStatistics[templateKey].MissCount;
+        element = InflateTemplate(templateKey);
     }
 
     return element;
@@ -132,4 +176,68 @@ void RecyclingElementFactory::RecycleElementCore(winrt::ElementFactoryRecycleArg
     m_recyclePool.get().PutElement(element, key, args.Parent());
 }
 
-#pragma endregion
\ No newline at end of file
+#pragma endregion
+
+winrt::FrameworkElement RecyclingElementFactory::InflateTemplate(winrt::hstring const& templateKey)
+{
+    QPCTimer timer;
+    auto dataTemplate = m_templates.get().Lookup(templateKey);
+    auto element = dataTemplate.LoadContent().as<winrt::FrameworkElement>();
+    const double inflateTime = timer.PreciseDurationInMilliSeconds();
+
+    // Associate ReuseKey with element
+    RecyclePool::SetReuseKey(element, templateKey);
+
+    auto& statistics = m_templateStatistics[templateKey];
+    ++statistics.InflateCount;
+    statistics.InflateTimeInMilliseconds += inflateTime;
+
+    REPEATER_TRACE_INFO(L"Inflated template %ls in %.2fms. Hits:%u Misses:%u Inflates:%u \n",
+        templateKey.data(), inflateTime, statistics.HitCount, statistics.MissCount, statistics.InflateCount);
+
+    return element;
+}
+
+void RecyclingElementFactory::RegisterForPrewarm()
+{
+    if (!m_registeredForPrewarm)
+    {
+        MUX_ASSERT(!m_pendingPrewarm.empty());
+        m_registeredForPrewarm = true;
+        BuildTreeScheduler::RegisterWork(
+            s_prewarmPriority,
+            [strongThis = get_strong()]()
+        {
+            strongThis->DoPrewarmWorkCallback();
+        });
+    }
+}
+
+void RecyclingElementFactory::DoPrewarmWorkCallback()
+{
+    m_registeredForPrewarm = false;
+
+    while (!m_pendingPrewarm.empty() && !BuildTreeScheduler::ShouldYield())
+    {
+        const auto key = m_pendingPrewarm.front().first;
+
+        // The templates or the pool could have been changed since the request was made.
+        const bool canInflate = m_recyclePool && m_templates && m_templates.get().HasKey(key);
+        if (canInflate)
+        {
+            auto element = InflateTemplate(key);
+            m_recyclePool.get().PutElement(element, key);
+        }
+
+        auto& remaining = m_pendingPrewarm.front().second;
+        if (!canInflate || --remaining == 0)
+        {
+            m_pendingPrewarm.erase(m_pendingPrewarm.begin());
+        }
+    }
+
+    if (!m_pendingPrewarm.empty())
+    {
+        RegisterForPrewarm();
+    }
+}
@@ -23,6 +23,12 @@ public:
     void SelectTemplateKey(winrt::event_token const& token);
 #pragma endregion
 
+#pragma region IRecyclingElementFactory (Preview)
+    void Prewarm(winrt::hstring const& key, int count);
+    winrt::RecyclingElementFactoryTemplateStatistics GetTemplateStatistics(winrt::hstring const& key);
+    void ResetTemplateStatistics();
+#pragma endregion
+
 #pragma region IRecyclingElementFactoryOverrides
     winrt::hstring OnSelectTemplateKeyCore(winrt::IInspectable const& dataContext, winrt::UIElement const& owner);
 #pragma endregion
@@ -33,8 +39,24 @@ public:
 #pragma endregion
 
 private:
+    winrt::FrameworkElement InflateTemplate(winrt::hstring const& templateKey);
+    void RegisterForPrewarm();
+    void DoPrewarmWorkCallback();
+
     tracker_ref<winrt::RecyclePool> m_recyclePool{ this };
     tracker_ref<winrt::IMap<winrt::hstring, winrt::DataTemplate>> m_templates{ this };
     tracker_ref<winrt::SelectTemplateEventArgs> m_args{ this };
     event_source<winrt::TypedEventHandler<winrt::RecyclingElementFactory, winrt::SelectTemplateEventArgs>> m_selectTemplateKeyEventSource{ this };
+
+    // Template keys still to be prewarmed, in request order, with the number of
+    // elements left to inflate for each.
+    std::vector<std::pair<winrt::hstring, int>> m_pendingPrewarm;
+    bool m_registeredForPrewarm{ false };
+
+    std::unordered_map<winrt::hstring, winrt::RecyclingElementFactoryTemplateStatistics> m_templateStatistics;
+
+    // Prewarming runs after phasing, which uses the phase as its priority. BuildTreeScheduler
+    // ages waiting work by one level every 4 frames, so continuous phasing delays prewarming
+    // by about 60 frames at most.
+    static constexpr int s_prewarmPriority = 15;
 };
\ No newline at end of file
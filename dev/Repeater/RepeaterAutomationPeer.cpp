@@ -22,6 +22,8 @@ RepeaterAutomationPeer::RepeaterAutomationPeer(winrt::ItemsRepeater const& owner
 winrt::IVector<winrt::AutomationPeer> RepeaterAutomationPeer::GetChildrenCore()
 {
     auto repeater = safe_cast<winrt::ItemsRepeater>(Owner());
+    // Peers are ordered by index.
+    winrt::get_self<ItemsRepeater>(repeater)->FlushPendingCollectionChanges();
     auto childrenPeers = GetInner().as<winrt::IAutomationPeerOverrides>().GetChildrenCore();
     unsigned peerCount = childrenPeers.Size();
 
@@ -5,6 +5,10 @@
 #include "common.h"
 #include "RepeaterTestHooksFactory.h"
 #include "layout.h"
+#include "QPCTimer.h"
+#include "BuildTreeScheduler.h"
+#include "ItemsSourceView.h"
+#include "SelectionModel.h"
 #ifdef BUILD_WINDOWS
 #include "ElementFactoryGetArgsDownlevel.h"
 #include "ElementFactoryRecycleArgsDownlevel.h"
@@ -84,4 +88,40 @@ void RepeaterTestHooks::SetLayoutId(winrt::IInspectable const& layout, hstring i
     {
         instance->LayoutId(id);
     }
-}
\ No newline at end of file
+}
+
+/* static */
+double RepeaterTestHooks::BuildTreeSchedulerMaxBudget()
+{
+    return BuildTreeScheduler::MaxBudgetInMs();
+}
+
+/* static */
+void RepeaterTestHooks::BuildTreeSchedulerMaxBudget(double value)
+{
+    BuildTreeScheduler::MaxBudgetInMs(value);
+}
+
+/* static */
+int RepeaterTestHooks::GetItemsSourceViewCacheHitCount(winrt::IInspectable const& itemsSourceView)
+{
+    return winrt::get_self<ItemsSourceView>(itemsSourceView.as<winrt::ItemsSourceView>())->ItemCacheHitCount();
+}
+
+/* static */
+int RepeaterTestHooks::GetItemsSourceViewCacheMissCount(winrt::IInspectable const& itemsSourceView)
+{
+    return winrt::get_self<ItemsSourceView>(itemsSourceView.as<winrt::ItemsSourceView>())->ItemCacheMissCount();
+}
+
+/* static */
+void RepeaterTestHooks::ResetItemsSourceViewCacheCounters(winrt::IInspectable const& itemsSourceView)
+{
+    winrt::get_self<ItemsSourceView>(itemsSourceView.as<winrt::ItemsSourceView>())->ResetItemCacheCounters();
+}
+
+/* static */
+int RepeaterTestHooks::GetSelectionModelRealizedNodeCount(winrt::IInspectable const& selectionModel)
+{
+    return winrt::get_self<SelectionModel>(selectionModel.as<winrt::SelectionModel>())->RealizedNodeCount();
+}
@@ -30,6 +30,15 @@ public:
     static hstring GetLayoutId(winrt::IInspectable const& layout);
     static void SetLayoutId(winrt::IInspectable const& layout, hstring id);
 
+    static double BuildTreeSchedulerMaxBudget();
+    static void BuildTreeSchedulerMaxBudget(double value);
+
+    static int GetItemsSourceViewCacheHitCount(winrt::IInspectable const& itemsSourceView);
+    static int GetItemsSourceViewCacheMissCount(winrt::IInspectable const& itemsSourceView);
+    static void ResetItemsSourceViewCacheCounters(winrt::IInspectable const& itemsSourceView);
+
+    static int GetSelectionModelRealizedNodeCount(winrt::IInspectable const& selectionModel);
+
 private:
     static RepeaterTestHooks* s_testHooks;
 
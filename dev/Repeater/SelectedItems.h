@@ -5,6 +5,11 @@
 
 struct SelectedItemInfo;
 
+// Flat view over the selected indices of several SelectionNodes. m_prefixCounts holds the
+// running total of selected items before each node, so GetAt finds the node with a binary
+// search and then asks the node's interval set for the index at that rank. When a getManyImpl
+// is provided, GetMany hands it each run of consecutive selected indices instead of calling
+// getAtImpl once per item.
 template <typename T>
 class SelectedItems:
     public ReferenceTracker<SelectedItems<T>,
@@ -12,15 +17,19 @@ class SelectedItems:
         typename winrt::IIterable<T>>
 {
 public:
-    SelectedItems(const std::vector<SelectedItemInfo>& infos, 
-        std::function<T(const std::vector<SelectedItemInfo>& infos, unsigned int index)> getAtImpl)
+    SelectedItems(const std::vector<SelectedItemInfo>& infos,
+        std::function<T(const SelectedItemInfo& info, int index)> getAtImpl,
+        std::function<uint32_t(const SelectedItemInfo& info, int startIndex, winrt::array_view<T> values)> getManyImpl = nullptr)
     {
         m_infos = infos;
         m_getAtImpl = getAtImpl;
+        m_getManyImpl = getManyImpl;
+        m_prefixCounts.reserve(infos.size());
         for (auto& info: infos)
         {
             if (auto node = info.Node.lock())
             {
+                m_prefixCounts.push_back(m_totalCount);
                 m_totalCount += node->SelectedCount();
             }
             else
@@ -43,7 +52,14 @@ public:
 
     T GetAt(uint32_t index)
     {
-        return m_getAtImpl(m_infos, index);
+        if (index >= m_totalCount)
+        {
+            throw winrt::hresult_out_of_bounds();
+        }
+
+        const auto infoIndex = FindInfoIndex(index);
+        auto node = LockNode(infoIndex);
+        return m_getAtImpl(m_infos[infoIndex], node->SelectedIndexAt(static_cast<int>(index - m_prefixCounts[infoIndex])));
     }
 
     bool IndexOf(T const& value, uint32_t &index) noexcept
@@ -51,9 +67,41 @@ public:
         winrt::throw_hresult(E_NOTIMPL);
     }
 
-    uint32_t GetMany(uint32_t startIndex, winrt::array_view<T> const& values) noexcept
+    uint32_t GetMany(uint32_t startIndex, winrt::array_view<T> const& values)
     {
-        winrt::throw_hresult(E_NOTIMPL);
+        uint32_t howMany = 0;
+        if (startIndex < m_totalCount)
+        {
+            // Stream the selected indices node by node, walking each node's ranges
+            // instead of looking every item up by rank.
+            auto infoIndex = FindInfoIndex(startIndex);
+            auto position = static_cast<int>(startIndex - m_prefixCounts[infoIndex]);
+            while (howMany < values.size() && infoIndex < m_infos.size())
+            {
+                auto node = LockNode(infoIndex);
+                const auto& ranges = node->SelectedRanges();
+                if (position < ranges.Count())
+                {
+                    if (m_getManyImpl)
+                    {
+                        howMany += GetManyFromRanges(m_infos[infoIndex], ranges, position,
+                            winrt::array_view<T>(values.begin() + howMany, values.end()));
+                    }
+                    else
+                    {
+                        for (auto it = ranges.IteratorAt(position); it != ranges.end() && howMany < values.size(); ++it)
+                        {
+                            values[howMany++] = m_getAtImpl(m_infos[infoIndex], *it);
+                        }
+                    }
+                }
+
+                ++infoIndex;
+                position = 0;
+            }
+        }
+
+        return howMany;
     }
 
 #pragma endregion
@@ -66,6 +114,50 @@ public:
 #pragma endregion
 
 private:
+    // Index in m_infos of the node that holds the item at the given flat index.
+    size_t FindInfoIndex(uint32_t index) const
+    {
+        auto it = std::upper_bound(m_prefixCounts.begin(), m_prefixCounts.end(), index);
+        return static_cast<size_t>(it - m_prefixCounts.begin()) - 1;
+    }
+
+    // Fills values with the items of the selected indices from the given rank on, one
+    // m_getManyImpl call per run of consecutive indices.
+    uint32_t GetManyFromRanges(const SelectedItemInfo& info, const IndexRangeSet& ranges, int position, winrt::array_view<T> values) const
+    {
+        const int firstIndex = ranges.At(position);
+        const auto& indexRanges = ranges.Ranges();
+        auto range = std::lower_bound(indexRanges.begin(), indexRanges.end(), firstIndex,
+            [](const IndexRange& range, int index) { return range.End() < index; });
+
+        uint32_t howMany = 0;
+        for (; range != indexRanges.end() && howMany < values.size(); ++range)
+        {
+            const int runStart = std::max(range->Begin(), firstIndex);
+            const auto runLength = std::min(static_cast<uint32_t>(range->End() - runStart + 1), values.size() - howMany);
+            const auto copied = m_getManyImpl(info, runStart, winrt::array_view<T>(values.begin() + howMany, values.begin() + howMany + runLength));
+            howMany += copied;
+            if (copied < runLength)
+            {
+                // The source is shorter than the selection thinks it is.
+                throw winrt::hresult_error(E_FAIL, L"Selection has changed since SelectedIndices/Items property was read.");
+            }
+        }
+
+        return howMany;
+    }
+
+    std::shared_ptr<SelectionNode> LockNode(size_t infoIndex) const
+    {
+        auto node = m_infos[infoIndex].Node.lock();
+        if (!node)
+        {
+            throw winrt::hresult_error(E_FAIL, L"Selection has changed since SelectedIndices/Items property was read.");
+        }
+
+        return node;
+    }
+
     class Iterator :
         public ReferenceTracker<Iterator, reference_tracker_implements_t<winrt::IIterator<T>>::type>
     {
@@ -116,13 +208,8 @@ private:
             uint32_t howMany = 0;
             if (HasCurrent())
             {
-                do
-                {
-                    if (howMany >= values.size()) break;
-
-                    values[howMany] = Current();
-                    howMany++;
-                } while (MoveNext());
+                howMany = m_selectedItems.GetMany(m_currentIndex, values);
+                m_currentIndex += howMany;
             }
 
             return howMany;
@@ -134,6 +221,9 @@ private:
     };
 
     std::vector<SelectedItemInfo> m_infos;
+    // m_prefixCounts[i] is the number of selected items in m_infos[0..i).
+    std::vector<unsigned int> m_prefixCounts;
     unsigned int m_totalCount{ 0 };
-    std::function<T(const std::vector<SelectedItemInfo>& infos, int /*index*/)> m_getAtImpl;
+    std::function<T(const SelectedItemInfo& info, int /*index*/)> m_getAtImpl;
+    std::function<uint32_t(const SelectedItemInfo& info, int /*startIndex*/, winrt::array_view<T> /*values*/)> m_getManyImpl;
 };
\ No newline at end of file
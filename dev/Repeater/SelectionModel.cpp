@@ -12,6 +12,7 @@
 #include "SelectionModelChildrenRequestedEventArgs.h"
 #include "Vector.h"
 #include "SelectedItems.h"
+#include "ItemsSourceView.h"
 #include "CustomProperty.h"
 
 CppWinRTActivatableClassWithBasicFactory(SelectionModel);
@@ -100,15 +101,7 @@ winrt::IndexPath SelectionModel::AnchorIndex()
     winrt::IndexPath anchor = nullptr;
     if (m_rootNode->AnchorIndex() >= 0)
     {
-        std::vector<int> path;
-        auto current = m_rootNode;
-        while (current && current->AnchorIndex() >= 0)
-        {
-            path.emplace_back(current->AnchorIndex());
-            current = current->GetAt(current->AnchorIndex(), false);
-        }
-
-        anchor = winrt::make<IndexPath>(path);
+        anchor = winrt::make<IndexPath>(AnchorPath());
     }
 
     return anchor;
@@ -116,15 +109,18 @@ winrt::IndexPath SelectionModel::AnchorIndex()
 
 void SelectionModel::AnchorIndex(winrt::IndexPath const& value)
 {
+    // The nodes on the old anchor path are no longer kept alive by the anchor.
+    const auto oldAnchorPath = AnchorPath();
+
     if (value)
     {
         SelectionTreeHelper::TraverseIndexPath(
             m_rootNode,
-            value,
+            IndexPath::PathOf(value),
             true, /* realizeChildren */
-            [](std::shared_ptr<SelectionNode> currentNode, const winrt::IndexPath& path, int depth, int childIndex)
+            [](const std::shared_ptr<SelectionNode>& currentNode, const CompactIndexPath& /*path*/, int /*depth*/, int childIndex)
         {
-            currentNode->AnchorIndex(path.GetAt(depth));
+            currentNode->AnchorIndex(childIndex);
         }
         );
     }
@@ -133,6 +129,7 @@ void SelectionModel::AnchorIndex(winrt::IndexPath const& value)
         m_rootNode->AnchorIndex(-1);
     }
 
+    EvictUnusedNodesAlongPath(oldAnchorPath);
     RaisePropertyChanged(L"AnchorIndex");
 }
 
@@ -197,31 +194,13 @@ winrt::IVectorView<winrt::IInspectable> SelectionModel::SelectedItems()
         // easier to consume flat vector view of objects.
         auto selectedItems = winrt::make<::SelectedItems<winrt::IInspectable>>(
             selectedInfos,
-            [](const std::vector<SelectedItemInfo>& infos, unsigned int index) // callback for GetAt(index)
+            [](const SelectedItemInfo& info, int index) // callback for GetAt(index)
         {
-            unsigned int currentIndex = 0;
-            winrt::IInspectable item{ nullptr };
-            for (auto& info : infos)
-            {
-                if (auto node = info.Node.lock())
-                {
-                    unsigned int currentCount = node->SelectedCount();
-                    if (index >= currentIndex && index < currentIndex + currentCount)
-                    {
-                        int targetIndex = node->SelectedIndices().at(index - currentIndex);
-                        item = node->ItemsSourceView().GetAt(targetIndex);
-                        break;
-                    }
-
-                    currentIndex += currentCount;
-                }
-                else
-                {
-                    throw winrt::hresult_error(E_FAIL, L"selection has changed since SelectedItems property was read.");
-                }
-            }
-
-            return item;
+            return info.Node.lock()->ItemsSourceView().GetAt(index);
+        },
+            [](const SelectedItemInfo& info, int startIndex, winrt::array_view<winrt::IInspectable> values) // callback for GetMany(startIndex, values)
+        {
+            return winrt::get_self<ItemsSourceView>(info.Node.lock()->ItemsSourceView())->GetMany(startIndex, values);
         });
         m_selectedItemsCached = selectedItems;
     }
@@ -252,31 +231,9 @@ winrt::IVectorView<winrt::IndexPath> SelectionModel::SelectedIndices()
         // easier to consume flat vector view of IndexPaths.
         auto indices = winrt::make<::SelectedItems<winrt::IndexPath>>(
             selectedInfos,
-            [](const std::vector<SelectedItemInfo>& infos, unsigned int index) // callback for GetAt(index)
+            [](const SelectedItemInfo& info, int index) // callback for GetAt(index)
         {
-            unsigned int currentIndex = 0;
-            winrt::IndexPath path{ nullptr };
-            for (auto& info : infos)
-            {
-                if (auto node = info.Node.lock())
-                {
-                    unsigned int currentCount = node->SelectedCount();
-                    if (index >= currentIndex && index < currentIndex + currentCount)
-                    {
-                        int targetIndex = node->SelectedIndices().at(index - currentIndex);
-                        path = winrt::get_self<IndexPath>(info.Path)->CloneWithChildIndex(targetIndex);
-                        break;
-                    }
-
-                    currentIndex += currentCount;
-                }
-                else
-                {
-                    throw winrt::hresult_error(E_FAIL, L"selection has changed since SelectedIndices property was read.");
-                }
-            }
-
-            return path;
+            return winrt::make<IndexPath>(info.Path.CloneWithChildIndex(index));
         });
         m_selectedIndicesCached = indices;
     }
@@ -432,6 +389,8 @@ void SelectionModel::SelectAll()
         }
     });
 
+    // Empty groups were realized on the way but have nothing to select.
+    m_rootNode->EvictUnusedChildren(true /* isOnAnchorPath */);
     OnSelectionChanged();
 }
 
@@ -440,6 +399,25 @@ void SelectionModel::ClearSelection()
     ClearSelection(true /*resetAnchor*/, true /* raiseSelectionChanged */);
 }
 
+void SelectionModel::BeginBatch()
+{
+    ++m_batchDepth;
+}
+
+void SelectionModel::EndBatch()
+{
+    if (m_batchDepth == 0)
+    {
+        throw winrt::hresult_error(E_FAIL, L"EndBatch called without a matching BeginBatch.");
+    }
+
+    if (--m_batchDepth == 0 && m_isSelectionChangedPending)
+    {
+        m_isSelectionChangedPending = false;
+        OnSelectionChanged();
+    }
+}
+
 #pragma endregion
 
 #pragma region ICustomPropertyProvider
@@ -575,11 +553,69 @@ void SelectionModel::ClearSelection(bool resetAnchor, bool raiseSelectionChanged
     }
 }
 
+int SelectionModel::RealizedNodeCount()
+{
+    return m_rootNode->RealizedNodeCount();
+}
+
+CompactIndexPath SelectionModel::AnchorPath()
+{
+    CompactIndexPath path;
+    auto current = m_rootNode;
+    while (current && current->AnchorIndex() >= 0)
+    {
+        path.Append(current->AnchorIndex());
+        current = current->GetAt(current->AnchorIndex(), false);
+    }
+
+    return path;
+}
+
+// Walks down the path and releases the nodes on it that hold no selection, starting at the
+// deepest one. The rest of the tree is left alone, which keeps single item operations
+// proportional to the depth of the tree.
+void SelectionModel::EvictUnusedNodesAlongPath(const CompactIndexPath& path)
+{
+    std::vector<std::shared_ptr<SelectionNode>> nodes;
+    std::vector<bool> isOnAnchorPath;
+    auto node = m_rootNode;
+    bool onAnchorPath = true;
+    for (int depth = 0; depth < path.Size() && node && node != m_leafNode; depth++)
+    {
+        if (path[depth] >= node->ChildrenNodeCount())
+        {
+            break;
+        }
+
+        nodes.push_back(node);
+        isOnAnchorPath.push_back(onAnchorPath);
+        onAnchorPath = onAnchorPath && node->AnchorIndex() == path[depth];
+        node = node->GetAt(path[depth], false /* realizeChild */);
+    }
+
+    for (int depth = static_cast<int>(nodes.size()) - 1; depth >= 0; depth--)
+    {
+        if (!nodes[depth]->TryEvictChild(path[depth], isOnAnchorPath[depth]))
+        {
+            // The parents of a node that stays realized have to stay as well.
+            break;
+        }
+    }
+}
+
 void SelectionModel::OnSelectionChanged()
 {
     m_selectedIndicesCached = nullptr;
     m_selectedItemsCached = nullptr;
 
+    if (m_batchDepth > 0)
+    {
+        // Reads inside the batch still see the current selection, the notifications
+        // wait for EndBatch.
+        m_isSelectionChangedPending = true;
+        return;
+    }
+
     // Raise SelectionChanged event
     if (m_selectionChangedEventSource)
     {
@@ -643,11 +679,11 @@ void SelectionModel::SelectWithPathImpl(const winrt::IndexPath& index, bool sele
 
     SelectionTreeHelper::TraverseIndexPath(
         m_rootNode,
-        index,
+        IndexPath::PathOf(index),
         true, /* realizeChildren */
-        [&selected, &select](std::shared_ptr<SelectionNode> currentNode, const winrt::IndexPath& path, int depth, int childIndex)
+        [&selected, &select](const std::shared_ptr<SelectionNode>& currentNode, const CompactIndexPath& path, int depth, int childIndex)
         {
-            if (depth == path.GetSize() - 1)
+            if (depth == path.Size() - 1)
             {
                 selected = currentNode->Select(childIndex, select);
             }
@@ -658,6 +694,10 @@ void SelectionModel::SelectWithPathImpl(const winrt::IndexPath& index, bool sele
     {
         AnchorIndex(index);
     }
+    else
+    {
+        EvictUnusedNodesAlongPath(IndexPath::PathOf(index));
+    }
 
     if (raiseSelectionChanged)
     {
@@ -715,6 +755,8 @@ void SelectionModel::SelectRangeFromAnchorWithGroupImpl(int endGroupIndex, int e
         selected |= groupNode->SelectRange(IndexRange(startIndex, endIndex), select);
     }
 
+    m_rootNode->EvictUnusedChildren(true /* isOnAnchorPath */);
+
     if (selected)
     {
         OnSelectionChanged();
@@ -737,16 +779,18 @@ void SelectionModel::SelectRangeImpl(const winrt::IndexPath& start, const winrt:
     // Note: Since we do not know the depth of the tree, we have to walk to each leaf
     SelectionTreeHelper::TraverseRangeRealizeChildren(
         m_rootNode,
-        winrtStart,
-        winrtEnd,
+        IndexPath::PathOf(winrtStart),
+        IndexPath::PathOf(winrtEnd),
         [select](const SelectionTreeHelper::TreeWalkNodeInfo& info)
     {
         if (info.Node->DataCount() == 0)
         {
             // Select only leaf nodes
-            info.ParentNode->Select(info.Path.GetAt(info.Path.GetSize() - 1), select);
+            info.ParentNode->Select(info.Path.Back(), select);
         }
     });
 
+    // The walk realizes every node in the range, deselecting leaves them all empty.
+    m_rootNode->EvictUnusedChildren(true /* isOnAnchorPath */);
     OnSelectionChanged();
 }
\ No newline at end of file
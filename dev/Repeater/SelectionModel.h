@@ -4,11 +4,12 @@
 #pragma once
 
 #include "SelectionModel.g.h"
+#include "CompactIndexPath.h"
 
 struct SelectedItemInfo
 {
     std::weak_ptr<SelectionNode> Node;
-    winrt::IndexPath Path;
+    CompactIndexPath Path;
 };
 
 class SelectionModel :
@@ -70,6 +71,9 @@ public:
     void SelectAll(void);
     void ClearSelection(void);
 
+    void BeginBatch();
+    void EndBatch();
+
 #pragma endregion
 
 #pragma region ICustomPropertyProvider
@@ -91,11 +95,14 @@ public:
     winrt::IInspectable ResolvePath(const winrt::IInspectable& data);
     void OnSelectionInvalidatedDueToCollectionChange();
     std::shared_ptr<SelectionNode> SharedLeafNode() { return m_leafNode; }
+    int RealizedNodeCount();
 
 private:
     void RaisePropertyChanged(std::wstring_view const& name);
     void ClearSelection(bool resetAnchor, bool raiseSelectionChanged);
     void OnSelectionChanged();
+    CompactIndexPath AnchorPath();
+    void EvictUnusedNodesAlongPath(const CompactIndexPath& path);
 
     void SelectImpl(int index, bool select);
     void SelectWithGroupImpl(int groupIndex, int itemIndex, bool select);
@@ -107,6 +114,10 @@ private:
     std::shared_ptr<SelectionNode> m_rootNode{ nullptr };
     bool m_singleSelect{ false };
 
+    // Nesting depth of BeginBatch calls, and whether the selection changed in the batch.
+    int m_batchDepth{ 0 };
+    bool m_isSelectionChangedPending{ false };
+
     winrt::IVectorView<winrt::IndexPath> m_selectedIndicesCached{ nullptr };
     winrt::IVectorView<winrt::IInspectable> m_selectedItemsCached{ nullptr };
 
@@ -2,7 +2,7 @@
 // Licensed under the MIT License. See LICENSE in the project root for license information.
 
 #pragma once
-#include "IndexRange.h"
+#include "IndexRangeSet.h"
 
 class SelectionModel;
 
@@ -40,7 +40,9 @@ public:
     bool IsSelected(int index);
     int SelectedIndex();
     void SelectedIndex(int value);
-    std::vector<int> SelectedIndices();
+    // Returns the selected index at the given position in ascending order.
+    int SelectedIndexAt(int position);
+    const IndexRangeSet& SelectedRanges() const { return m_selected; }
     bool Select(int index, bool select);
     bool ToggleSelect(int index);
     void SelectAll();
@@ -49,18 +51,22 @@ public:
     SelectionState EvaluateIsSelectedBasedOnChildrenNodes();
     static winrt::IReference<bool> ConvertToNullableBool(SelectionState isSelected);
 
+    // Child nodes are released once they carry no state: nothing selected in or below them,
+    // not selected themselves and not on the anchor path. GetAt(index, true) realizes them
+    // again through the manager when a walk needs them.
+    bool TryEvictChild(int index, bool isOnAnchorPath);
+    void EvictUnusedChildren(bool isOnAnchorPath);
+    // Number of realized non-leaf nodes in this subtree, including this node.
+    int RealizedNodeCount();
+
 private:
     void HookupCollectionChangedHandler();
     void UnhookCollectionChangedHandler();
     bool IsValidIndex(int index);
-    void AddRange(const IndexRange& addRange, bool raiseOnSelectionChanged);
-    void RemoveRange(const IndexRange& removeRange, bool raiseOnSelectionChanged);
     void ClearSelection();
-    bool Select(int index, bool select, bool raiseOnSelectionChanged);
     void OnSourceListChanged(const winrt::IInspectable& dataSource, const winrt::NotifyCollectionChangedEventArgs& args);
     bool OnItemsAdded(int index, int count);
     bool OnItemsRemoved(int index, int count);
-    void OnSelectionChanged();
 
     SelectionModel* m_manager;
 
@@ -73,15 +79,12 @@ private:
     SelectionNode* m_parent { nullptr };
 
     // For parents of leaf nodes (any node whose children are not data sources)
-    std::vector<IndexRange> m_selected;
+    IndexRangeSet m_selected;
     
     tracker_ref<winrt::IInspectable> m_source;
     tracker_ref<winrt::ItemsSourceView> m_dataSource;
     winrt::ItemsSourceView::CollectionChanged_revoker m_itemsSourceViewChanged{};
 
-    int m_selectedCount{ 0 };
-    std::vector<int> m_selectedIndicesCached;
-    bool m_selectedIndicesCacheIsValid = false;
     int m_anchorIndex{ -1 };
     int m_realizedChildrenNodeCount{ 0 };
 };
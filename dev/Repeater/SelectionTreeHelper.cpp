@@ -11,17 +11,17 @@
 // static
 void SelectionTreeHelper::TraverseIndexPath(
     std::shared_ptr<SelectionNode> root,
-    const winrt::IndexPath& path,
+    const CompactIndexPath& path,
     bool realizeChildren,
-    std::function<void(std::shared_ptr<SelectionNode>, const winrt::IndexPath&, int /*depth*/, int /*childIndex*/)> nodeAction)
+    std::function<void(const std::shared_ptr<SelectionNode>&, const CompactIndexPath&, int /*depth*/, int /*childIndex*/)> nodeAction)
 {
     auto node = root;
-    for (int depth = 0; depth < path.GetSize(); depth++)
+    for (int depth = 0; depth < path.Size(); depth++)
     {
-        int childIndex = path.GetAt(depth);
+        int childIndex = path[depth];
         nodeAction(node, path, depth, childIndex);
 
-        if (depth < path.GetSize() - 1)
+        if (depth < path.Size() - 1)
         {
             node = node->GetAt(childIndex, realizeChildren);
         }
@@ -35,21 +35,19 @@ void SelectionTreeHelper::Traverse(
     std::function<void(const TreeWalkNodeInfo&)> nodeAction)
 {
     auto pendingNodes = std::vector<TreeWalkNodeInfo>();
-    auto current = winrt::make<IndexPath>(nullptr);
-    pendingNodes.push_back(TreeWalkNodeInfo(root, current));
+    pendingNodes.push_back(TreeWalkNodeInfo(root, CompactIndexPath()));
 
     while (pendingNodes.size() > 0)
     {
-        auto nextNode = pendingNodes.back();
+        auto nextNode = std::move(pendingNodes.back());
         pendingNodes.pop_back();
         int count = realizeChildren ? nextNode.Node->DataCount() : nextNode.Node->ChildrenNodeCount();
         for (int i = count - 1; i >= 0; i--)
         {
             std::shared_ptr<SelectionNode> child = nextNode.Node->GetAt(i, realizeChildren);
-            auto childPath = winrt::get_self<IndexPath>(nextNode.Path)->CloneWithChildIndex(i);
             if (child != nullptr)
             {
-                pendingNodes.push_back(TreeWalkNodeInfo(child, childPath, nextNode.Node));
+                pendingNodes.push_back(TreeWalkNodeInfo(child, nextNode.Path.CloneWithChildIndex(i), nextNode.Node));
             }
         }
 
@@ -63,14 +61,14 @@ void SelectionTreeHelper::Traverse(
 // static 
 void SelectionTreeHelper::TraverseRangeRealizeChildren(
     std::shared_ptr<SelectionNode> root,
-    const winrt::IndexPath& start,
-    const winrt::IndexPath& end,
+    const CompactIndexPath& start,
+    const CompactIndexPath& end,
     std::function<void(const TreeWalkNodeInfo&)> nodeAction)
 {
     MUX_ASSERT(start.CompareTo(end) == -1);
 
     auto pendingNodes = std::vector<TreeWalkNodeInfo>();
-    winrt::IndexPath current = start;
+    CompactIndexPath currentPath;
 
     // Build up the stack to account for the depth first walk up to the 
     // start index path.
@@ -78,50 +76,24 @@ void SelectionTreeHelper::TraverseRangeRealizeChildren(
         root,
         start,
         true, /* realizeChildren */
-        [&start, &end, &pendingNodes](std::shared_ptr<SelectionNode> node, const winrt::IndexPath& path, int depth, int childIndex)
+        [&start, &end, &pendingNodes, &currentPath](const std::shared_ptr<SelectionNode>& node, const CompactIndexPath& /*path*/, int /*depth*/, int childIndex)
     {
-        auto currentPath = StartPath(path, depth);
-        bool isStartPath = IsSubSet(start, currentPath);
-        bool isEndPath = IsSubSet(end, currentPath);
-
-        int startIndex = depth < start.GetSize() && isStartPath ? start.GetAt(depth) : 0;
-        int endIndex = depth < end.GetSize() && isEndPath ? end.GetAt(depth) : node->DataCount() - 1;
-
-        for (int i = endIndex; i >= startIndex; i--)
-        {
-            auto child = node->GetAt(i, true /* realizeChild */);
-            if (child)
-            {
-                auto childPath = winrt::get_self<IndexPath>(currentPath)->CloneWithChildIndex(i);
-                pendingNodes.push_back(TreeWalkNodeInfo(child, childPath, node));
-            }
-        }
+        // currentPath is the first depth levels of the start path.
+        PushChildrenInRange(node, currentPath, start, end, pendingNodes);
+        currentPath.Append(childIndex);
     });
 
     // From the start index path, do a depth first walk as long as the
     // current path is less than the end path.
     while (pendingNodes.size() > 0)
     {
-        auto info = pendingNodes.back();
+        auto info = std::move(pendingNodes.back());
         pendingNodes.pop_back();
-        int depth = info.Path.GetSize();
-        bool isStartPath = IsSubSet(start, info.Path);
-        bool isEndPath = IsSubSet(end, info.Path);
-        int startIndex = depth < start.GetSize() && isStartPath ? start.GetAt(depth) : 0;
-        int endIndex = depth < end.GetSize() && isEndPath ? end.GetAt(depth) : info.Node->DataCount() - 1;
-        for (int i = endIndex; i >= startIndex; i--)
-        {
-            auto child = info.Node->GetAt(i, true /* realizeChild */);
-            if (child)
-            {
-                auto childPath = winrt::get_self<IndexPath>(info.Path)->CloneWithChildIndex(i);
-                pendingNodes.push_back(TreeWalkNodeInfo(child, childPath, info.Node));
-            }
-        }
+        PushChildrenInRange(info.Node, info.Path, start, end, pendingNodes);
 
         nodeAction(info);
 
-        if (info.Path.CompareTo(end) == 0)
+        if (info.Path == end)
         {
             // We reached the end index path. stop iterating.
             break;
@@ -129,28 +101,27 @@ void SelectionTreeHelper::TraverseRangeRealizeChildren(
     }
 }
 
-// static 
-bool SelectionTreeHelper::IsSubSet(const winrt::IndexPath& path, const winrt::IndexPath& subset)
+// static
+void SelectionTreeHelper::PushChildrenInRange(
+    const std::shared_ptr<SelectionNode>& node,
+    const CompactIndexPath& path,
+    const CompactIndexPath& start,
+    const CompactIndexPath& end,
+    std::vector<TreeWalkNodeInfo>& pendingNodes)
 {
-    bool isSubset = true;
-    for (int i = 0; i < subset.GetSize(); i++)
+    int depth = path.Size();
+    bool isStartPath = start.StartsWith(path);
+    bool isEndPath = end.StartsWith(path);
+    int startIndex = depth < start.Size() && isStartPath ? start[depth] : 0;
+    int endIndex = depth < end.Size() && isEndPath ? end[depth] : node->DataCount() - 1;
+
+    // Pushed in reverse so that the walk pops them in ascending order.
+    for (int i = endIndex; i >= startIndex; i--)
     {
-        isSubset = path.GetAt(i) == subset.GetAt(i);
-        if (!isSubset)
-            break;
+        auto child = node->GetAt(i, true /* realizeChild */);
+        if (child)
+        {
+            pendingNodes.push_back(TreeWalkNodeInfo(child, path.CloneWithChildIndex(i), node));
+        }
     }
-
-    return isSubset;
 }
-
-// static 
-winrt::IndexPath SelectionTreeHelper::StartPath(const winrt::IndexPath& path, int length)
-{
-    std::vector<int> subPath;
-    for (int i = 0; i < length; i++)
-    {
-        subPath.emplace_back(path.GetAt(i));
-    }
-
-    return winrt::make<IndexPath>(subPath);
-}
\ No newline at end of file
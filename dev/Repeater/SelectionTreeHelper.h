@@ -3,26 +3,31 @@
 
 #pragma once
 
+#include "CompactIndexPath.h"
+
+// The walks below track the current position with a CompactIndexPath so that visiting a node
+// of a shallow tree does not allocate; callers create a winrt::IndexPath only when they hand
+// a path out through the public API.
 class SelectionTreeHelper
 {
 public:
     struct TreeWalkNodeInfo
     {
-        TreeWalkNodeInfo(std::shared_ptr<SelectionNode> node, const winrt::IndexPath& indexPath, std::shared_ptr<SelectionNode> parent)
-            : Node(node), Path(indexPath), ParentNode(parent) {}
-        TreeWalkNodeInfo(std::shared_ptr<SelectionNode> node, const winrt::IndexPath& indexPath)
-            : Node(node), Path(indexPath), ParentNode(nullptr) {}
+        TreeWalkNodeInfo(std::shared_ptr<SelectionNode> node, CompactIndexPath&& indexPath, std::shared_ptr<SelectionNode> parent)
+            : Node(std::move(node)), Path(std::move(indexPath)), ParentNode(std::move(parent)) {}
+        TreeWalkNodeInfo(std::shared_ptr<SelectionNode> node, CompactIndexPath&& indexPath)
+            : Node(std::move(node)), Path(std::move(indexPath)), ParentNode(nullptr) {}
 
         std::shared_ptr<SelectionNode> Node;
-        winrt::IndexPath Path;
+        CompactIndexPath Path;
         std::shared_ptr<SelectionNode> ParentNode;
     };
 
     static void TraverseIndexPath(
         std::shared_ptr<SelectionNode> root,
-        const winrt::IndexPath& path,
+        const CompactIndexPath& path,
         bool realizeChildren,
-        std::function<void(std::shared_ptr<SelectionNode>, const winrt::IndexPath&, int /*depth*/, int /*childIndex*/)> nodeAction);
+        std::function<void(const std::shared_ptr<SelectionNode>&, const CompactIndexPath&, int /*depth*/, int /*childIndex*/)> nodeAction);
 
     static void Traverse(
         std::shared_ptr<SelectionNode> root,
@@ -31,11 +36,15 @@ public:
 
     static void TraverseRangeRealizeChildren(
         std::shared_ptr<SelectionNode> root,
-        const winrt::IndexPath& start,
-        const winrt::IndexPath& end,
+        const CompactIndexPath& start,
+        const CompactIndexPath& end,
         std::function<void(const TreeWalkNodeInfo&)> nodeAction);
 
 private:
-    static bool IsSubSet(const winrt::IndexPath& path, const winrt::IndexPath& subset);
-    static winrt::IndexPath StartPath(const winrt::IndexPath& path, int length);
+    static void PushChildrenInRange(
+        const std::shared_ptr<SelectionNode>& node,
+        const CompactIndexPath& path,
+        const CompactIndexPath& start,
+        const CompactIndexPath& end,
+        std::vector<TreeWalkNodeInfo>& pendingNodes);
 };
@@ -0,0 +1,142 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "SequenceDiff.h"
+
+/* static */
+bool SequenceDiff::TryComputeEdits(
+    const std::vector<int>& oldSequence,
+    const std::vector<int>& newSequence,
+    int maxEdits,
+    std::vector<Edit>& edits)
+{
+    edits.clear();
+
+    // Most refreshes only touch a few items, so take the common ends off first.
+    int prefix = 0;
+    const int oldEnd = static_cast<int>(oldSequence.size());
+    const int newEnd = static_cast<int>(newSequence.size());
+    while (prefix < oldEnd && prefix < newEnd && oldSequence[prefix] == newSequence[prefix])
+    {
+        ++prefix;
+    }
+
+    int suffix = 0;
+    while (suffix < oldEnd - prefix && suffix < newEnd - prefix &&
+        oldSequence[oldEnd - 1 - suffix] == newSequence[newEnd - 1 - suffix])
+    {
+        ++suffix;
+    }
+
+    const int* a = oldSequence.data() + prefix;
+    const int* b = newSequence.data() + prefix;
+    const int n = oldEnd - prefix - suffix;
+    const int m = newEnd - prefix - suffix;
+    if (n + m == 0)
+    {
+        return true;
+    }
+
+    maxEdits = std::min(maxEdits, n + m);
+
+    // v[offset + k] is the furthest x reached on diagonal k. trace[d] holds v[-d..d] as it
+    // was at the end of step d, which the backtrack below needs to recover the path.
+    const int offset = maxEdits + 1;
+    std::vector<int> v(2 * offset + 1, 0);
+    std::vector<std::vector<int>> trace;
+    int editCount = -1;
+
+    for (int d = 0; d <= maxEdits && editCount < 0; d++)
+    {
+        for (int k = -d; k <= d; k += 2)
+        {
+            int x = (k == -d || (k != d && v[offset + k - 1] < v[offset + k + 1])) ?
+                v[offset + k + 1] :
+                v[offset + k - 1] + 1;
+            int y = x - k;
+            while (x < n && y < m && a[x] == b[y])
+            {
+                ++x;
+                ++y;
+            }
+
+            v[offset + k] = x;
+            if (x >= n && y >= m)
+            {
+                editCount = d;
+                break;
+            }
+        }
+
+        trace.emplace_back(v.begin() + offset - d, v.begin() + offset + d + 1);
+    }
+
+    if (editCount < 0)
+    {
+        return false;
+    }
+
+    // Walk back from (n, m) and record, in reverse, which element each step removed or inserted.
+    struct Step { bool IsInsert; int SequenceIndex; };
+    std::vector<Step> steps;
+    steps.reserve(editCount);
+    int x = n;
+    int y = m;
+    for (int d = editCount; d > 0; d--)
+    {
+        // trace[d - 1] covers diagonals -(d - 1)..(d - 1).
+        const auto& previous = trace[d - 1];
+        auto previousAt = [&previous, d](int k) { return previous[k + d - 1]; };
+
+        const int k = x - y;
+        const bool isInsert = (k == -d || (k != d && previousAt(k - 1) < previousAt(k + 1)));
+        const int previousK = isInsert ? k + 1 : k - 1;
+        const int previousX = previousAt(previousK);
+        const int previousY = previousX - previousK;
+
+        steps.push_back(isInsert ? Step{ true, previousY } : Step{ false, previousX });
+        x = previousX;
+        y = previousY;
+    }
+
+    // Replay forward. Before a step on a[i] or b[j] the sequence is b[0..j) followed by what
+    // is left of a, so inserts land at j and removes at i shifted by the net edits so far.
+    int removed = 0;
+    int inserted = 0;
+    for (auto it = steps.rbegin(); it != steps.rend(); ++it)
+    {
+        if (it->IsInsert)
+        {
+            AppendEdit(edits, EditKind::Insert, prefix + it->SequenceIndex);
+            ++inserted;
+        }
+        else
+        {
+            AppendEdit(edits, EditKind::Remove, prefix + it->SequenceIndex - removed + inserted);
+            ++removed;
+        }
+    }
+
+    return true;
+}
+
+/* static */
+void SequenceDiff::AppendEdit(std::vector<Edit>& edits, EditKind kind, int index)
+{
+    // Merge runs: consecutive removes hit the same index, consecutive inserts the next one.
+    if (!edits.empty())
+    {
+        auto& last = edits.back();
+        if (last.Kind == kind &&
+            ((kind == EditKind::Remove && index == last.Index) ||
+             (kind == EditKind::Insert && index == last.Index + last.Count)))
+        {
+            ++last.Count;
+            return;
+        }
+    }
+
+    edits.push_back(Edit{ kind, index, 1 });
+}
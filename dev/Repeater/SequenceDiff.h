@@ -0,0 +1,32 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Shortest edit script between two sequences (Myers' O((N+M)D) algorithm), expressed as the
+// Remove and Insert operations that turn the old sequence into the new one when applied in
+// order. Each operation's Index is relative to the sequence as it is after the previous
+// operations, which is what collection change notifications expect.
+class SequenceDiff final
+{
+public:
+    enum class EditKind { Remove, Insert };
+
+    struct Edit
+    {
+        EditKind Kind;
+        int Index;
+        int Count;
+    };
+
+    // Returns false, leaving edits empty, if more than maxEdits removes and inserts would
+    // be needed.
+    static bool TryComputeEdits(
+        const std::vector<int>& oldSequence,
+        const std::vector<int>& newSequence,
+        int maxEdits,
+        std::vector<Edit>& edits);
+
+private:
+    static void AppendEdit(std::vector<Edit>& edits, EditKind kind, int index);
+};
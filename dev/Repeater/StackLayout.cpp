@@ -45,6 +45,7 @@ void StackLayout::InitializeForContextCore(winrt::VirtualizingLayoutContext cons
     }
 
     stackState->InitializeForContext(context, this);
+    stackState->IsSizeIndexEnabled(m_isItemSizeIndexEnabled);
 }
 
 void StackLayout::UninitializeForContextCore(winrt::VirtualizingLayoutContext const& context)
@@ -57,7 +58,14 @@ winrt::Size StackLayout::MeasureOverride(
     winrt::VirtualizingLayoutContext const& context,
     winrt::Size const& availableSize)
 {
-    auto desiredSize = GetFlowAlgorithm(context).Measure(
+    const auto stackState = GetAsStackState(context.LayoutState());
+    stackState->IsSizeIndexEnabled(m_isItemSizeIndexEnabled);
+    if (m_isItemSizeIndexEnabled)
+    {
+        stackState->SizeIndex().Resize(context.ItemCount());
+    }
+
+    auto desiredSize = stackState->FlowAlgorithm().Measure(
         availableSize,
         context,
         false, /* isWrapping*/
@@ -88,7 +96,9 @@ void StackLayout::OnItemsChangedCore(
     winrt::IInspectable const& source,
     winrt::NotifyCollectionChangedEventArgs const& args)
 {
-    GetFlowAlgorithm(context).OnItemsSourceChanged(source, args, context);
+    const auto stackState = GetAsStackState(context.LayoutState());
+    stackState->OnItemsChanged(args);
+    stackState->FlowAlgorithm().OnItemsSourceChanged(source, args, context);
     // Always invalidate layout to keep the view accurate.
     InvalidateLayout();
 }
@@ -115,14 +125,29 @@ winrt::FlowLayoutAnchorInfo StackLayout::GetAnchorForRealizationRect(
 
         const double averageElementSize = GetAverageElementSize(availableSize, context, state) + m_itemSpacing;
         const double realizationWindowOffsetInExtent = realizationRect.*MajorStart() - lastExtent.*MajorStart();
-        const double majorSize = lastExtent.*MajorSize() == 0 ? std::max(0.0, averageElementSize * itemsCount - m_itemSpacing) : lastExtent.*MajorSize();
-        if (itemsCount > 0 &&
-            realizationRect.*MajorSize() > 0 &&
-            realizationWindowOffsetInExtent + realizationRect.*MajorSize() >= 0 && realizationWindowOffsetInExtent <= majorSize)
+        if (state->IsSizeIndexEnabled())
         {
-            anchorIndex = (int)(realizationWindowOffsetInExtent / averageElementSize);
-            offset = anchorIndex * averageElementSize + lastExtent.*MajorStart();
-            anchorIndex = std::max(0, std::min(itemsCount - 1, anchorIndex));
+            auto& sizeIndex = state->SizeIndex();
+            const double estimatedSize = averageElementSize - m_itemSpacing;
+            const double majorSize = lastExtent.*MajorSize() == 0 ? sizeIndex.GetTotalSize(estimatedSize, m_itemSpacing) : lastExtent.*MajorSize();
+            if (realizationRect.*MajorSize() > 0 &&
+                realizationWindowOffsetInExtent + realizationRect.*MajorSize() >= 0 && realizationWindowOffsetInExtent <= majorSize)
+            {
+                anchorIndex = sizeIndex.GetIndexAt(realizationWindowOffsetInExtent, estimatedSize, m_itemSpacing);
+                offset = sizeIndex.GetOffset(anchorIndex, estimatedSize, m_itemSpacing) + lastExtent.*MajorStart();
+            }
+        }
+        else
+        {
+            const double majorSize = lastExtent.*MajorSize() == 0 ? std::max(0.0, averageElementSize * itemsCount - m_itemSpacing) : lastExtent.*MajorSize();
+            if (itemsCount > 0 &&
+                realizationRect.*MajorSize() > 0 &&
+                realizationWindowOffsetInExtent + realizationRect.*MajorSize() >= 0 && realizationWindowOffsetInExtent <= majorSize)
+            {
+                anchorIndex = (int)(realizationWindowOffsetInExtent / averageElementSize);
+                offset = anchorIndex * averageElementSize + lastExtent.*MajorStart();
+                anchorIndex = std::max(0, std::min(itemsCount - 1, anchorIndex));
+            }
         }
     }
 
@@ -149,15 +174,35 @@ winrt::Rect StackLayout::GetExtent(
     const double averageElementSize = GetAverageElementSize(availableSize, context, stackState) + m_itemSpacing;
 
     extent.*MinorSize() = static_cast<float>(stackState->MaxArrangeBounds());
-    extent.*MajorSize() = std::max(0.0f, static_cast<float>(itemsCount * averageElementSize - m_itemSpacing));
+    if (stackState->IsSizeIndexEnabled())
+    {
+        const double estimatedSize = averageElementSize - m_itemSpacing;
+        extent.*MajorSize() = static_cast<float>(stackState->SizeIndex().GetTotalSize(estimatedSize, m_itemSpacing));
+    }
+    else
+    {
+        extent.*MajorSize() = std::max(0.0f, static_cast<float>(itemsCount * averageElementSize - m_itemSpacing));
+    }
+
     if (itemsCount > 0)
     {
         if (firstRealized)
         {
             MUX_ASSERT(lastRealized);
-            extent.*MajorStart() = static_cast<float>(firstRealizedLayoutBounds.*MajorStart() - firstRealizedItemIndex * averageElementSize);
-            auto remainingItems = itemsCount - lastRealizedItemIndex - 1;
-            extent.*MajorSize() = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + static_cast<float>(remainingItems* averageElementSize);
+            if (stackState->IsSizeIndexEnabled())
+            {
+                auto& sizeIndex = stackState->SizeIndex();
+                const double estimatedSize = averageElementSize - m_itemSpacing;
+                extent.*MajorStart() = static_cast<float>(firstRealizedLayoutBounds.*MajorStart() - sizeIndex.GetOffset(firstRealizedItemIndex, estimatedSize, m_itemSpacing));
+                const double remainingSize = sizeIndex.GetOffset(itemsCount, estimatedSize, m_itemSpacing) - sizeIndex.GetOffset(lastRealizedItemIndex + 1, estimatedSize, m_itemSpacing);
+                extent.*MajorSize() = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + static_cast<float>(remainingSize);
+            }
+            else
+            {
+                extent.*MajorStart() = static_cast<float>(firstRealizedLayoutBounds.*MajorStart() - firstRealizedItemIndex * averageElementSize);
+                auto remainingItems = itemsCount - lastRealizedItemIndex - 1;
+                extent.*MajorSize() = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + static_cast<float>(remainingItems* averageElementSize);
+            }
         }
         else
         {
@@ -245,7 +290,17 @@ winrt::FlowLayoutAnchorInfo StackLayout::Algorithm_GetAnchorForTargetElement(
         index = targetIndex;
         const auto state = GetAsStackState(context.LayoutState());
         const double averageElementSize = GetAverageElementSize(availableSize, context, state) + m_itemSpacing;
-        offset = index * averageElementSize + state->FlowAlgorithm().LastExtent().*MajorStart();
+        double offsetInExtent = index * averageElementSize;
+        if (state->IsSizeIndexEnabled())
+        {
+            // BringIntoView can get here before the size index has grown to the data count,
+            // so items past its end are estimated from the last offset it knows about.
+            auto& sizeIndex = state->SizeIndex();
+            const int knownIndex = std::min(index, sizeIndex.Count());
+            offsetInExtent = sizeIndex.GetOffset(knownIndex, averageElementSize - m_itemSpacing, m_itemSpacing) +
+                (index - knownIndex) * averageElementSize;
+        }
+        offset = offsetInExtent + state->FlowAlgorithm().LastExtent().*MajorStart();
     }
 
     return winrt::FlowLayoutAnchorInfo{ index, offset };
@@ -309,6 +364,10 @@ void StackLayout::OnPropertyChanged(const winrt::DependencyPropertyChangedEventA
     {
         m_itemSpacing = unbox_value<double>(args.NewValue());
     }
+    else if (property == s_IsItemSizeIndexEnabledProperty)
+    {
+        m_isItemSizeIndexEnabled = unbox_value<bool>(args.NewValue());
+    }
 
     InvalidateLayout();
 }
@@ -41,9 +41,49 @@ void StackLayoutState::OnElementMeasured(int elementIndex, double majorSize, dou
     m_estimationBuffer[estimationBufferIndex] = majorSize;
 
     m_maxArrangeBounds = std::max(m_maxArrangeBounds, minorSize);
+
+    if (m_isSizeIndexEnabled && elementIndex < m_sizeIndex.Count())
+    {
+        m_sizeIndex.SetSize(elementIndex, majorSize);
+    }
 }
 
 void StackLayoutState::OnArrangeLayoutEnd()
 {
     m_maxArrangeBounds = 0.0;
-}
\ No newline at end of file
+}
+
+void StackLayoutState::OnItemsChanged(const winrt::NotifyCollectionChangedEventArgs& args)
+{
+    if (m_isSizeIndexEnabled)
+    {
+        switch (args.Action())
+        {
+        case winrt::NotifyCollectionChangedAction::Add:
+            m_sizeIndex.OnItemsAdded(args.NewStartingIndex(), args.NewItems().Size());
+            break;
+
+        case winrt::NotifyCollectionChangedAction::Remove:
+            m_sizeIndex.OnItemsRemoved(args.OldStartingIndex(), args.OldItems().Size());
+            break;
+
+        case winrt::NotifyCollectionChangedAction::Replace:
+            m_sizeIndex.OnItemsRemoved(args.OldStartingIndex(), args.OldItems().Size());
+            m_sizeIndex.OnItemsAdded(args.NewStartingIndex(), args.NewItems().Size());
+            break;
+
+        case winrt::NotifyCollectionChangedAction::Reset:
+            m_sizeIndex.Clear();
+            break;
+        }
+    }
+}
+
+void StackLayoutState::IsSizeIndexEnabled(bool value)
+{
+    if (m_isSizeIndexEnabled != value)
+    {
+        m_isSizeIndexEnabled = value;
+        m_sizeIndex.Clear();
+    }
+}
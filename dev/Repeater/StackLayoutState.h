@@ -5,6 +5,7 @@
 
 #include "StackLayoutState.g.h"
 #include "FlowLayoutAlgorithm.h"
+#include "ItemSizeIndex.h"
 
 class StackLayoutState :
     public ReferenceTracker<StackLayoutState, winrt::implementation::StackLayoutStateT, winrt::composing>
@@ -16,6 +17,14 @@ public:
     void UninitializeForContext(const winrt::VirtualizingLayoutContext& context);
     void OnElementMeasured(int elementIndex, double majorSize, double minorSize);
     void OnArrangeLayoutEnd();
+    void OnItemsChanged(const winrt::NotifyCollectionChangedEventArgs& args);
+
+    // When enabled, the measured size of every item is tracked so that the extent
+    // and the offsets of unrealized items are computed from real sizes instead of
+    // extrapolating the average of the last BufferSize measured items.
+    void IsSizeIndexEnabled(bool value);
+    bool IsSizeIndexEnabled() const { return m_isSizeIndexEnabled; }
+    ::ItemSizeIndex& SizeIndex() { return m_sizeIndex; }
 
     ::FlowLayoutAlgorithm& FlowAlgorithm() { return m_flowAlgorithm; }
     double TotalElementSize() const { return m_totalElementSize; }
@@ -31,5 +40,7 @@ private:
     // is going to be used in the calculation of the extent.
     double m_maxArrangeBounds{};
     int m_totalElementsMeasured{};
+    bool m_isSizeIndexEnabled{};
+    ::ItemSizeIndex m_sizeIndex{};
     static const int BufferSize = 100;
 };
\ No newline at end of file
@@ -61,10 +61,13 @@ winrt::Size UniformGridLayout::MeasureOverride(
     auto gridState = GetAsGridState(context.LayoutState());
     gridState->EnsureElementSize(availableSize, context, m_minItemWidth, m_minItemHeight, m_itemsStretch, Orientation(), MinRowSpacing(), MinColumnSpacing());
 
-    auto desiredSize = GetFlowAlgorithm(context).Measure(
+    // All the items have the same size, so the flow algorithm can compute the realized
+    // range and the item positions directly instead of generating one item at a time.
+    const winrt::Size itemSize{ static_cast<float>(gridState->EffectiveItemWidth()), static_cast<float>(gridState->EffectiveItemHeight()) };
+    auto desiredSize = gridState->FlowAlgorithm().MeasureUniform(
         availableSize,
         context,
-        true, /* isWrapping*/
+        itemSize,
         MinItemSpacing(),
         LineSpacing(),
         OrientationBasedMeasures::GetScrollOrientation(),
@@ -135,8 +138,9 @@ winrt::FlowLayoutAnchorInfo UniformGridLayout::Algorithm_GetAnchorForRealization
     {
         const auto gridState = GetAsGridState(context.LayoutState());
         const auto lastExtent = gridState->FlowAlgorithm().LastExtent();
-        const int itemsPerLine = std::max(1, static_cast<int>(availableSize.*Minor() / GetMinorSizeWithSpacing(context)));
-        const double majorSize = (itemsCount / itemsPerLine) * GetMajorSizeWithSpacing(context);
+        const auto uniformInfo = GetUniformLayoutInfo(availableSize, context);
+        const int itemsPerLine = uniformInfo.ItemsPerLine;
+        const double majorSize = uniformInfo.ExtentMajorSize;
         const double realizationWindowStartWithinExtent = realizationRect.*MajorStart() - lastExtent.*MajorStart();
         if ((realizationWindowStartWithinExtent + realizationRect.*MajorSize()) >= 0 && realizationWindowStartWithinExtent <= majorSize)
         {
@@ -165,7 +169,7 @@ winrt::FlowLayoutAnchorInfo UniformGridLayout::Algorithm_GetAnchorForTargetEleme
     int count = context.ItemCount();
     if (targetIndex >= 0 && targetIndex < count)
     {
-        int itemsPerLine = std::max(1, static_cast<int>(availableSize.*Minor() / GetMinorSizeWithSpacing(context)));
+        int itemsPerLine = GetUniformLayoutInfo(availableSize, context).ItemsPerLine;
         int indexOfFirstInLine = (targetIndex / itemsPerLine) * itemsPerLine;
         index = indexOfFirstInLine;
         auto state = GetAsGridState(context.LayoutState());
@@ -196,26 +200,22 @@ winrt::Rect UniformGridLayout::Algorithm_GetExtent(
 
     // Constants
     const int itemsCount = context.ItemCount();
-    const float availableSizeMinor = availableSize.*Minor();
-    const int itemsPerLine = std::max(1, std::isfinite(availableSizeMinor) ?
-        static_cast<int>(availableSizeMinor / GetMinorSizeWithSpacing(context)) : itemsCount);
+    const auto uniformInfo = GetUniformLayoutInfo(availableSize, context);
+    const int itemsPerLine = uniformInfo.ItemsPerLine;
     const float lineSize = GetMajorSizeWithSpacing(context);
 
     if (itemsCount > 0)
     {
-        extent.*MinorSize() =
-            std::isfinite(availableSizeMinor) ?
-            availableSizeMinor :
-            std::max(0.0f, itemsCount * GetMinorSizeWithSpacing(context) - static_cast<float>(MinItemSpacing()));
-        extent.*MajorSize() = std::max(0.0f, (itemsCount / itemsPerLine) * lineSize - static_cast<float>(LineSpacing()));
+        extent.*MinorSize() = uniformInfo.ExtentMinorSize;
+        extent.*MajorSize() = uniformInfo.ExtentMajorSize;
 
         if (firstRealized)
         {
             MUX_ASSERT(lastRealized);
 
             extent.*MajorStart() = firstRealizedLayoutBounds.*MajorStart() - (firstRealizedItemIndex / itemsPerLine) * lineSize;
-            int remainingItems = itemsCount - lastRealizedItemIndex - 1;
-            extent.*MajorSize() = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + (remainingItems / itemsPerLine) * lineSize;
+            const int remainingLines = uniformInfo.LineCount - (lastRealizedItemIndex / itemsPerLine) - 1;
+            extent.*MajorSize() = MajorEnd(lastRealizedLayoutBounds) - extent.*MajorStart() + remainingLines * lineSize;
         }
         else
         {
@@ -228,7 +228,7 @@ winrt::Rect UniformGridLayout::Algorithm_GetExtent(
         MUX_ASSERT(lastRealizedItemIndex == -1);
     }
 
-    REPEATER_TRACE_INFO(L"%ls: \tExtent is (%.0f,%.0f). Based on lineSize %.0f and items per line %.0f. \n",
+    REPEATER_TRACE_INFO(L"%ls: \tExtent is (%.0f,%.0f). Based on lineSize %.0f and items per line %d. \n",
         LayoutId().data(), extent.Width, extent.Height, lineSize, itemsPerLine);
     return extent;
 }
@@ -295,13 +295,30 @@ float UniformGridLayout::GetMajorSizeWithSpacing(winrt::VirtualizingLayoutContex
         static_cast<float>(gridState->EffectiveItemWidth() + lineSpacing);
 }
 
+FlowLayoutAlgorithm::UniformLayoutInfo UniformGridLayout::GetUniformLayoutInfo(
+    const winrt::Size& availableSize,
+    const winrt::VirtualizingLayoutContext& context)
+{
+    auto gridState = GetAsGridState(context.LayoutState());
+    const bool isVertical = GetScrollOrientation() == ScrollOrientation::Vertical;
+    const float itemWidth = static_cast<float>(gridState->EffectiveItemWidth());
+    const float itemHeight = static_cast<float>(gridState->EffectiveItemHeight());
+    return FlowLayoutAlgorithm::GetUniformLayoutInfo(
+        context.ItemCount(),
+        availableSize.*Minor(),
+        isVertical ? itemWidth : itemHeight,
+        isVertical ? itemHeight : itemWidth,
+        MinItemSpacing(),
+        LineSpacing());
+}
+
 winrt::Rect UniformGridLayout::GetLayoutRectForDataIndex(
     const winrt::Size& availableSize,
     int index,
     const winrt::Rect& lastExtent, 
     const winrt::VirtualizingLayoutContext& context)
 {
-    int itemsPerLine = std::max(1, static_cast<int>(availableSize.*Minor() / GetMinorSizeWithSpacing(context)));
+    int itemsPerLine = GetUniformLayoutInfo(availableSize, context).ItemsPerLine;
     int rowIndex = static_cast<int>(index / itemsPerLine);
     int indexInRow = index - (rowIndex * itemsPerLine);
 
@@ -75,6 +75,7 @@ private:
     // Methods
     float GetMinorSizeWithSpacing(winrt::VirtualizingLayoutContext const& context);
     float GetMajorSizeWithSpacing(winrt::VirtualizingLayoutContext const& context);
+    FlowLayoutAlgorithm::UniformLayoutInfo GetUniformLayoutInfo(const winrt::Size& availableSize, const winrt::VirtualizingLayoutContext& context);
 
     winrt::Rect GetLayoutRectForDataIndex(const winrt::Size& availableSize, int index, const winrt::Rect& lastExtent, const winrt::VirtualizingLayoutContext& context);
 
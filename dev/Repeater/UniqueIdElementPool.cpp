@@ -18,15 +18,17 @@ void UniqueIdElementPool::Add(const winrt::UIElement& element)
     MUX_ASSERT(m_owner->ItemsSourceView().HasKeyIndexMapping());
 
     auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
-    auto key = std::wstring(virtInfo->UniqueId().data());
+    const auto key = virtInfo->UniqueId();
+    const auto hash = HashKey(key);
 
-    if (m_elementMap.find(key) != m_elementMap.end())
+    EnsureCapacity(m_count + 1);
+    if (FindSlot(key, hash) != -1)
     {
-        std::wstring message = L"The unique id provided (" + std::wstring(virtInfo->UniqueId().data()) + L") is not unique.";
+        std::wstring message = L"The unique id provided (" + std::wstring(key.data()) + L") is not unique.";
         throw winrt::hresult_error(E_FAIL, message.c_str());
     }
 
-    m_elementMap.insert(std::make_pair(std::move(key), tracker_ref<winrt::UIElement>(m_owner, element)));
+    InsertIntoEmptySlot(hash, element);
 }
 
 winrt::UIElement UniqueIdElementPool::Remove(int index)
@@ -35,12 +37,15 @@ winrt::UIElement UniqueIdElementPool::Remove(int index)
 
     // Check if there is already a element in the mapping and if so, use it.
     winrt::UIElement element = nullptr;
-    std::wstring key = std::wstring(m_owner->ItemsSourceView().KeyFromIndex(index));
-    auto it = m_elementMap.find(key);
-    if (it != m_elementMap.end())
+    if (m_count > 0)
     {
-        element = it->second.get();
-        m_elementMap.erase(it);
+        const auto key = m_owner->ItemsSourceView().KeyFromIndex(index);
+        const int slot = FindSlot(key, HashKey(key));
+        if (slot != -1)
+        {
+            element = m_elements[slot].get();
+            RemoveSlot(slot);
+        }
     }
 
     return element;
@@ -49,5 +54,121 @@ winrt::UIElement UniqueIdElementPool::Remove(int index)
 void UniqueIdElementPool::Clear()
 {
     MUX_ASSERT(m_owner->ItemsSourceView().HasKeyIndexMapping());
-    m_elementMap.clear();
-}
\ No newline at end of file
+
+    if (m_count > 0)
+    {
+        // Keep the slots (and their tracker handles) for the next reset.
+        for (auto& element : m_elements)
+        {
+            element.set(nullptr);
+        }
+
+        m_count = 0;
+    }
+}
+
+/* static */
+uint64_t UniqueIdElementPool::HashKey(wstring_view key)
+{
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    for (const auto ch : key)
+    {
+        hash ^= static_cast<uint64_t>(ch);
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+int UniqueIdElementPool::FindSlot(wstring_view key, uint64_t hash) const
+{
+    if (m_elements.empty())
+    {
+        return -1;
+    }
+
+    const int mask = static_cast<int>(m_elements.size()) - 1;
+    for (int slot = HomeSlot(hash); m_elements[slot].get(); slot = (slot + 1) & mask)
+    {
+        if (m_hashes[slot] == hash &&
+            ItemsRepeater::GetVirtualizationInfo(m_elements[slot].get())->UniqueId() == key)
+        {
+            return slot;
+        }
+    }
+
+    return -1;
+}
+
+void UniqueIdElementPool::InsertIntoEmptySlot(uint64_t hash, const winrt::UIElement& element)
+{
+    const int mask = static_cast<int>(m_elements.size()) - 1;
+    int slot = HomeSlot(hash);
+    while (m_elements[slot].get())
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    m_hashes[slot] = hash;
+    m_elements[slot].set(element);
+    m_count++;
+}
+
+void UniqueIdElementPool::RemoveSlot(int slot)
+{
+    // Backward shift deletion: move later entries of the probe sequence into the hole
+    // so that lookups never have to skip over deleted slots.
+    const int mask = static_cast<int>(m_elements.size()) - 1;
+    int hole = slot;
+    for (int next = (hole + 1) & mask; m_elements[next].get(); next = (next + 1) & mask)
+    {
+        const int home = HomeSlot(m_hashes[next]);
+        // The entry can move to the hole only if its home slot is not cyclically within (hole, next].
+        const bool homeIsBetween = hole <= next ?
+            (home > hole && home <= next) :
+            (home > hole || home <= next);
+        if (!homeIsBetween)
+        {
+            m_hashes[hole] = m_hashes[next];
+            m_elements[hole].set(m_elements[next].get());
+            hole = next;
+        }
+    }
+
+    m_elements[hole].set(nullptr);
+    m_count--;
+}
+
+void UniqueIdElementPool::EnsureCapacity(int count)
+{
+    // Keep the load factor at or below one half.
+    if (static_cast<size_t>(count) * 2 > m_elements.size())
+    {
+        size_t capacity = std::max<size_t>(s_minCapacity, m_elements.size());
+        while (static_cast<size_t>(count) * 2 > capacity)
+        {
+            capacity *= 2;
+        }
+
+        auto oldHashes = std::move(m_hashes);
+        auto oldElements = std::move(m_elements);
+
+        m_hashes.assign(capacity, 0);
+        m_elements.clear();
+        m_elements.reserve(capacity);
+        for (size_t i = 0; i < capacity; i++)
+        {
+            m_elements.emplace_back(m_owner);
+        }
+
+        m_count = 0;
+        for (size_t i = 0; i < oldElements.size(); i++)
+        {
+            if (auto element = oldElements[i].get())
+            {
+                InsertIntoEmptySlot(oldHashes[i], element);
+            }
+        }
+    }
+}
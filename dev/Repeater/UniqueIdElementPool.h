@@ -5,6 +5,10 @@
 
 class ItemsRepeater;
 
+// Elements cleared during a stable reset, keyed by their unique id. This is an open addressing
+// hash table (linear probing) that only stores 64-bit hashes of the ids. Collisions are resolved
+// by comparing with the unique id already stored in the element's VirtualizationInfo, so no key
+// is copied. Clearing keeps the slots around, so repeated resets of a similar size do not allocate.
 class UniqueIdElementPool final
 {
 public:
@@ -14,10 +18,31 @@ public:
     winrt::UIElement Remove(int index);
     void Clear();
 
-    auto begin() const { return m_elementMap.begin(); }
-    auto end() const { return m_elementMap.end(); }
+    template <typename Func>
+    void ForEach(Func func) const
+    {
+        for (const auto& element : m_elements)
+        {
+            if (auto value = element.get())
+            {
+                func(value);
+            }
+        }
+    }
 
 private:
+    static uint64_t HashKey(wstring_view key);
+    int FindSlot(wstring_view key, uint64_t hash) const;
+    void InsertIntoEmptySlot(uint64_t hash, const winrt::UIElement& element);
+    void RemoveSlot(int slot);
+    void EnsureCapacity(int count);
+    int HomeSlot(uint64_t hash) const { return static_cast<int>(hash & (m_elements.size() - 1)); }
+
     ItemsRepeater* m_owner{ nullptr };
-    std::map<std::wstring, tracker_ref<winrt::UIElement>> m_elementMap;
-};
\ No newline at end of file
+    // Both vectors have the same power of two size. A slot is empty when its element is null.
+    std::vector<uint64_t> m_hashes;
+    std::vector<tracker_ref<winrt::UIElement>> m_elements;
+    int m_count{ 0 };
+
+    static constexpr int s_minCapacity = 16;
+};
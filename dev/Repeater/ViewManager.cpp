@@ -485,13 +485,13 @@ void ViewManager::OnOwnerArranged()
     {
         m_isDataSourceStableResetPending = false;
 
-        for (auto& entry : m_resetPool)
+        m_resetPool.ForEach([this](const winrt::UIElement& element)
         {
             // TODO: Task 14204306: ItemsRepeater: Find better focus candidate when focused element is deleted in the ItemsSource.
             // Focused element is getting cleared. Need to figure out semantics on where
             // focus should go when the focused element is removed from the data collection.
-            ClearElement(entry.second.get(), true /* isClearedDueToCollectionChange */);
-        }
+            ClearElement(element, true /* isClearedDueToCollectionChange */);
+        });
 
         m_resetPool.Clear();
     }
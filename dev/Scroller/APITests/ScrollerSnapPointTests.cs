@@ -4,8 +4,10 @@
 using MUXControlsTestApp.Utilities;
 using System;
 using System.Numerics;
+using System.Threading;
 using Windows.UI.Xaml.Controls;
 using Windows.UI.Xaml.Controls.Primitives;
+using Windows.UI.Xaml.Shapes;
 using Common;
 
 #if USING_TAEF
@@ -23,6 +25,8 @@ using ScrollSnapPointsAlignment = Microsoft.UI.Xaml.Controls.Primitives.ScrollSn
 using ScrollSnapPoint = Microsoft.UI.Xaml.Controls.Primitives.ScrollSnapPoint;
 using RepeatedScrollSnapPoint = Microsoft.UI.Xaml.Controls.Primitives.RepeatedScrollSnapPoint;
 using ZoomSnapPoint = Microsoft.UI.Xaml.Controls.Primitives.ZoomSnapPoint;
+using AnimationMode = Microsoft.UI.Xaml.Controls.AnimationMode;
+using SnapPointsMode = Microsoft.UI.Xaml.Controls.SnapPointsMode;
 
 using ScrollerTestHooks = Microsoft.UI.Private.Controls.ScrollerTestHooks;
 #endif
@@ -287,5 +291,164 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
                 Verify.AreEqual<int>(1, combinationCount31);
             });
         }
+
+        [TestMethod]
+        [TestProperty("Description", "Snaps to one of many center-aligned scroll snap points before and after the viewport size changes.")]
+        public void SnapToOneOfManyViewportSensitiveSnapPoints()
+        {
+            const int snapPointCount = 5000;
+            const double snapPointsInterval = 10.0;
+
+            Scroller scroller = null;
+            Rectangle rectangleScrollerContent = null;
+            ScrollSnapPoint snapPoint110 = null;
+            ScrollSnapPoint snapPoint109 = null;
+            AutoResetEvent scrollerLoadedEvent = new AutoResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                rectangleScrollerContent = new Rectangle();
+                scroller = new Scroller();
+
+                SetupDefaultUI(scroller, rectangleScrollerContent, scrollerLoadedEvent);
+
+                rectangleScrollerContent.Height = snapPointCount * snapPointsInterval;
+
+                var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+
+                for (int i = 0; i < snapPointCount; i++)
+                {
+                    ScrollSnapPoint snapPoint = new ScrollSnapPoint(snapPointValue: i * snapPointsInterval, alignment: ScrollSnapPointsAlignment.Center);
+
+                    scroller.VerticalSnapPoints.Add(snapPoint);
+
+                    if (i == 109)
+                    {
+                        snapPoint109 = snapPoint;
+                    }
+                    else if (i == 110)
+                    {
+                        snapPoint110 = snapPoint;
+                    }
+                }
+
+                stopwatch.Stop();
+                Log.Comment(string.Format("Added {0} vertical snap points in {1} ms.", snapPointCount, stopwatch.ElapsedMilliseconds));
+            });
+
+            WaitForEvent("Waiting for Loaded event", scrollerLoadedEvent);
+
+            RunOnUIThread.Execute(() =>
+            {
+                Vector2 snapPoint110ApplicableZone = ScrollerTestHooks.GetVerticalSnapPointActualApplicableZone(scroller, snapPoint110);
+                Log.Comment("snapPoint110ApplicableZone=" + snapPoint110ApplicableZone.ToString());
+
+                Log.Comment("Expecting the snap point at 1100 to apply to the 995-1005 offset range with a 200px viewport");
+                Verify.AreEqual<float>(995.0f, snapPoint110ApplicableZone.X);
+                Verify.AreEqual<float>(1005.0f, snapPoint110ApplicableZone.Y);
+            });
+
+            ScrollTo(scroller, 0.0, 1003.0, AnimationMode.Disabled, SnapPointsMode.Default, false /*hookViewChanged*/, expectedFinalVerticalOffset: 1000.0);
+
+            RunOnUIThread.Execute(() =>
+            {
+                Log.Comment("Shrinking the Scroller height to 100px");
+                scroller.Height = 100.0;
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Vector2 snapPoint109ApplicableZone = ScrollerTestHooks.GetVerticalSnapPointActualApplicableZone(scroller, snapPoint109);
+                Log.Comment("snapPoint109ApplicableZone=" + snapPoint109ApplicableZone.ToString());
+
+                Log.Comment("Expecting the snap point at 1090 to apply to the 1035-1045 offset range with a 100px viewport");
+                Verify.AreEqual<float>(1035.0f, snapPoint109ApplicableZone.X);
+                Verify.AreEqual<float>(1045.0f, snapPoint109ApplicableZone.Y);
+            });
+
+            ScrollTo(scroller, 0.0, 1043.0, AnimationMode.Disabled, SnapPointsMode.Default, false /*hookViewChanged*/, expectedFinalVerticalOffset: 1040.0);
+        }
+
+        [TestMethod]
+        [TestProperty("Description", "Measures the setup of irregular scroll snap points with and without composite inertia modifiers.")]
+        public void MeasureCompositeSnapPointsSetup()
+        {
+            try
+            {
+                foreach (int snapPointCount in new int[] { 10, 100, 1000 })
+                {
+                    foreach (bool areCompositeSnapPointsEnabled in new bool[] { false, true })
+                    {
+                        RunOnUIThread.Execute(() =>
+                        {
+                            ScrollerTestHooks.AreCompositeSnapPointsEnabled = areCompositeSnapPointsEnabled;
+
+                            Scroller scroller = new Scroller();
+                            var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+
+                            for (int i = 0; i < snapPointCount; i++)
+                            {
+                                scroller.VerticalSnapPoints.Add(new ScrollSnapPoint(snapPointValue: i * 10, alignment: ScrollSnapPointsAlignment.Near));
+                            }
+
+                            stopwatch.Stop();
+
+                            int modifierCount = ScrollerTestHooks.GetVerticalSnapPointsInertiaModifierCount(scroller);
+
+                            Log.Comment(string.Format("AreCompositeSnapPointsEnabled={0}: added {1} snap points in {2} ms, resulting in {3} inertia modifiers.",
+                                areCompositeSnapPointsEnabled, snapPointCount, stopwatch.ElapsedMilliseconds, modifierCount));
+
+                            // Composites hold up to 32 snap points.
+                            int expectedModifierCount = areCompositeSnapPointsEnabled ? (snapPointCount + 31) / 32 : snapPointCount;
+                            Verify.AreEqual<int>(expectedModifierCount, modifierCount);
+                        });
+                    }
+                }
+            }
+            finally
+            {
+                RunOnUIThread.Execute(() =>
+                {
+                    ScrollerTestHooks.AreCompositeSnapPointsEnabled = true;
+                });
+            }
+        }
+
+        [TestMethod]
+        [TestProperty("Description", "Flicks a Scroller with composite inertia modifiers and verifies it rests on a snap point.")]
+        public void InertiaRestsOnCompositeSnapPoint()
+        {
+            Scroller scroller = null;
+            Rectangle rectangleScrollerContent = null;
+            AutoResetEvent scrollerLoadedEvent = new AutoResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                rectangleScrollerContent = new Rectangle();
+                scroller = new Scroller();
+
+                SetupDefaultUI(scroller, rectangleScrollerContent, scrollerLoadedEvent);
+
+                for (int i = 0; i <= 40; i++)
+                {
+                    scroller.VerticalSnapPoints.Add(new ScrollSnapPoint(snapPointValue: i * 10, alignment: ScrollSnapPointsAlignment.Near));
+                }
+
+                Log.Comment("Expecting a composite of 32 snap points followed by a composite of 9 snap points");
+                Verify.AreEqual<int>(2, ScrollerTestHooks.GetVerticalSnapPointsInertiaModifierCount(scroller));
+            });
+
+            WaitForEvent("Waiting for Loaded event", scrollerLoadedEvent);
+
+            ScrollFrom(scroller, 0.0f, 250.0f, null /*horizontalInertiaDecayRate*/, null /*verticalInertiaDecayRate*/, false /*hookViewChanged*/);
+
+            RunOnUIThread.Execute(() =>
+            {
+                Log.Comment("Expecting the final vertical offset to be a multiple of 10");
+                Verify.IsLessThan(Math.Abs(scroller.VerticalOffset - Math.Round(scroller.VerticalOffset / 10.0) * 10.0), 0.01);
+            });
+        }
     }
 }
@@ -774,6 +774,85 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        [TestProperty("Description", "Performs consecutive non-animated offsets changes with IsViewChangeCoalescingEnabled set.")]
+        public void CoalescedOffsetJumps()
+        {
+            const int scrollByCount = 4;
+            Scroller scroller = null;
+            Rectangle rectangleScrollerContent = null;
+            AutoResetEvent scrollerLoadedEvent = new AutoResetEvent(false);
+            AutoResetEvent[] scrollerViewChangeOperationEvents = null;
+            ScrollerOperation[] operations = null;
+
+            RunOnUIThread.Execute(() =>
+            {
+                rectangleScrollerContent = new Rectangle();
+                scroller = new Scroller();
+                scroller.IsViewChangeCoalescingEnabled = true;
+
+                SetupDefaultUI(scroller, rectangleScrollerContent, scrollerLoadedEvent);
+            });
+
+            WaitForEvent("Waiting for Loaded event", scrollerLoadedEvent);
+
+            RunOnUIThread.Execute(() =>
+            {
+                scrollerViewChangeOperationEvents = new AutoResetEvent[scrollByCount + 1];
+                operations = new ScrollerOperation[scrollByCount + 1];
+
+                for (int operationIndex = 0; operationIndex <= scrollByCount; operationIndex++)
+                {
+                    scrollerViewChangeOperationEvents[operationIndex] = new AutoResetEvent(false);
+                }
+
+                scroller.ViewChanged += (sender, args) =>
+                {
+                    Log.Comment("ViewChanged - HorizontalOffset={0}, VerticalOffset={1}, ZoomFactor={2}",
+                        sender.HorizontalOffset, sender.VerticalOffset, sender.ZoomFactor);
+                };
+
+                operations[0] = StartScrollTo(
+                    scroller,
+                    600.0,
+                    400.0,
+                    AnimationMode.Disabled,
+                    SnapPointsMode.Ignore,
+                    scrollerViewChangeOperationEvents[0]);
+
+                for (int operationIndex = 1; operationIndex <= scrollByCount; operationIndex++)
+                {
+                    operations[operationIndex] = StartScrollBy(
+                        scroller,
+                        -25.0,
+                        -25.0,
+                        AnimationMode.Disabled,
+                        SnapPointsMode.Ignore,
+                        scrollerViewChangeOperationEvents[operationIndex]);
+                }
+            });
+
+            for (int operationIndex = 0; operationIndex <= scrollByCount; operationIndex++)
+            {
+                WaitForEvent("Waiting for view change completion #" + operationIndex, scrollerViewChangeOperationEvents[operationIndex]);
+            }
+
+            RunOnUIThread.Execute(() =>
+            {
+                Log.Comment("Final HorizontalOffset={0}, VerticalOffset={1}, ZoomFactor={2}",
+                    scroller.HorizontalOffset, scroller.VerticalOffset, scroller.ZoomFactor);
+
+                Verify.AreEqual(scroller.HorizontalOffset, 500.0);
+                Verify.AreEqual(scroller.VerticalOffset, 300.0);
+                Verify.AreEqual(scroller.ZoomFactor, 1.0f);
+
+                foreach (ScrollerOperation operation in operations)
+                {
+                    Verify.AreEqual(operation.Result, ScrollerViewChangeResult.Completed);
+                }
+            });
+        }
+
         [TestMethod]
         [TestProperty("Description", "Performs consecutive non-animated zoomFactor changes.")]
         public void ConsecutiveZoomFactorJumps()
@@ -0,0 +1,186 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Layout inputs that place an anchor candidate within the Scroller.Content. When none of them changed across an
+// arrange pass, the bounds captured for the candidate are still current and its TransformToVisual can be skipped.
+struct AnchorCandidateLayout
+{
+    // Identity of the candidate's parent. Only compared, never dereferenced.
+    const void* parent{ nullptr };
+    // The parent's unit square transformed into the Content's coordinate space.
+    winrt::Rect parentBounds{};
+    winrt::Rect layoutSlot{};
+    winrt::Thickness margin{};
+    float actualWidth{};
+    float actualHeight{};
+
+    bool operator==(const AnchorCandidateLayout& other) const
+    {
+        return parent == other.parent &&
+            parentBounds == other.parentBounds &&
+            layoutSlot == other.layoutSlot &&
+            margin == other.margin &&
+            actualWidth == other.actualWidth &&
+            actualHeight == other.actualHeight;
+    }
+};
+
+// Bounds of the Scroller's registered anchor candidates within the Content, kept parallel to Scroller::m_anchorCandidates.
+// The valid candidates are sorted by their start along one axis and m_maxEnds[i] is the largest end among the first
+// i + 1 entries, so the candidates overlapping a range are found with a binary search. Arrange passes only mark the
+// captured layouts as needing a check; the bounds of a candidate are only recomputed when its layout changed.
+class AnchorCandidateIndex
+{
+public:
+    void OnCandidateAdded()
+    {
+        m_candidates.push_back({});
+        m_areLayoutsChecked = false;
+        m_isSorted = false;
+    }
+
+    void OnCandidateRemoved(size_t candidateIndex)
+    {
+        MUX_ASSERT(candidateIndex < m_candidates.size());
+
+        m_candidates.erase(m_candidates.begin() + candidateIndex);
+        m_isSorted = false;
+    }
+
+    void Clear()
+    {
+        m_candidates.clear();
+        m_entries.clear();
+        m_maxEnds.clear();
+        m_areLayoutsChecked = false;
+        m_isSorted = false;
+    }
+
+    // Called after an arrange pass, which may have moved any candidate.
+    void InvalidateLayouts()
+    {
+        m_areLayoutsChecked = false;
+    }
+
+    bool AreLayoutsChecked() const
+    {
+        return m_areLayoutsChecked;
+    }
+
+    void MarkLayoutsChecked()
+    {
+        m_areLayoutsChecked = true;
+    }
+
+    // Returns True when the candidate's bounds were captured for the provided layout.
+    bool HasLayout(size_t candidateIndex, const AnchorCandidateLayout& layout) const
+    {
+        const Candidate& candidate = m_candidates[candidateIndex];
+
+        return candidate.isValid && candidate.hasLayout && candidate.layout == layout;
+    }
+
+    // Records the bounds of a valid candidate. A null layout means the bounds cannot be reused and are recomputed on the next check.
+    void SetBounds(size_t candidateIndex, const AnchorCandidateLayout* layout, const winrt::Rect& bounds)
+    {
+        Candidate& candidate = m_candidates[candidateIndex];
+
+        candidate.layout = layout ? *layout : AnchorCandidateLayout{};
+        candidate.hasLayout = layout != nullptr;
+        candidate.bounds = bounds;
+        candidate.isValid = true;
+        m_isSorted = false;
+    }
+
+    void SetInvalid(size_t candidateIndex)
+    {
+        Candidate& candidate = m_candidates[candidateIndex];
+
+        if (candidate.isValid)
+        {
+            candidate = {};
+            m_isSorted = false;
+        }
+    }
+
+    // Sorts the valid candidates along the provided axis, unless that was already done since the last change.
+    void EnsureSorted(bool isVertical)
+    {
+        if (m_isSorted && m_isVertical == isVertical)
+        {
+            return;
+        }
+
+        m_isVertical = isVertical;
+        m_entries.clear();
+        m_maxEnds.clear();
+
+        for (size_t candidateIndex = 0; candidateIndex < m_candidates.size(); candidateIndex++)
+        {
+            const Candidate& candidate = m_candidates[candidateIndex];
+
+            if (candidate.isValid)
+            {
+                const float start = isVertical ? candidate.bounds.Y : candidate.bounds.X;
+                const float end = start + (isVertical ? candidate.bounds.Height : candidate.bounds.Width);
+
+                m_entries.push_back({ start, end, static_cast<int>(candidateIndex) });
+            }
+        }
+
+        std::sort(m_entries.begin(), m_entries.end(), [](const Entry& entry1, const Entry& entry2) { return entry1.start < entry2.start; });
+
+        m_maxEnds.reserve(m_entries.size());
+
+        for (const Entry& entry : m_entries)
+        {
+            m_maxEnds.push_back(m_maxEnds.empty() ? entry.end : std::max(m_maxEnds.back(), entry.end));
+        }
+
+        m_isSorted = true;
+    }
+
+    // Invokes func(candidateIndex, bounds) for each valid candidate whose bounds reach into the provided rect along the sorted axis.
+    template <typename F>
+    void ForEachOverlapping(const winrt::Rect& rect, F func) const
+    {
+        MUX_ASSERT(m_isSorted);
+
+        const float start = m_isVertical ? rect.Y : rect.X;
+        const float end = start + (m_isVertical ? rect.Height : rect.Width);
+        const size_t first = std::lower_bound(m_maxEnds.begin(), m_maxEnds.end(), start) - m_maxEnds.begin();
+
+        for (size_t index = first; index < m_entries.size() && m_entries[index].start <= end; index++)
+        {
+            if (m_entries[index].end >= start)
+            {
+                func(m_entries[index].candidateIndex, m_candidates[m_entries[index].candidateIndex].bounds);
+            }
+        }
+    }
+
+private:
+    struct Candidate
+    {
+        AnchorCandidateLayout layout{};
+        winrt::Rect bounds{};
+        bool hasLayout{ false };
+        bool isValid{ false };
+    };
+
+    struct Entry
+    {
+        float start;
+        float end;
+        int candidateIndex;
+    };
+
+    std::vector<Candidate> m_candidates;
+    std::vector<Entry> m_entries;
+    std::vector<float> m_maxEnds;
+    bool m_isVertical{ true };
+    bool m_isSorted{ false };
+    bool m_areLayoutsChecked{ false };
+};
@@ -0,0 +1,230 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "CompositeSnapPointWrapper.h"
+
+template<typename T>
+CompositeSnapPointWrapper<T>::CompositeSnapPointWrapper(std::vector<SnapPointWrapper<T>*> const& snapPointWrappers)
+    : m_snapPointWrappers(snapPointWrappers)
+{
+    MUX_ASSERT(m_snapPointWrappers.size() > 1);
+}
+
+template<typename T>
+SnapPointWrapper<T>* CompositeSnapPointWrapper<T>::First() const
+{
+    return m_snapPointWrappers.front();
+}
+
+template<typename T>
+int CompositeSnapPointWrapper<T>::SnapPointCount() const
+{
+    return static_cast<int>(m_snapPointWrappers.size());
+}
+
+// Creates the expression '(it.IsInertiaFromImpulse ? <impulse partition> : <partition>) * scale', where a partition
+// is a tree of conditionals comparing the target to the boundaries between the snap points' zones, with
+// the snap point values as leaves. The expression string only depends on the snap points count, target and scale.
+template<typename T>
+winrt::ExpressionAnimation CompositeSnapPointWrapper<T>::CreateRestingPointExpression(
+    winrt::InteractionTracker const& interactionTracker,
+    winrt::hstring const& target,
+    winrt::hstring const& scale,
+    bool isInertiaFromImpulse,
+    CompositeSnapPointExpressionCache& expressionCache)
+{
+    const int snapPointCount = SnapPointCount();
+    const std::wstring signature = L"r" + std::to_wstring(snapPointCount) + L"|" + target.c_str() + L"|" + scale.c_str();
+    auto cachedExpression = expressionCache.find(signature);
+
+    if (cachedExpression == expressionCache.end())
+    {
+        SnapPointBase* snapPoint = FirstSnapPoint();
+        const winrt::hstring isInertiaFromImpulseExpression = snapPoint->GetIsInertiaFromImpulseExpression(L"this.Target");
+        const winrt::hstring targetExpression = snapPoint->GetTargetExpression(target);
+        std::wstring expression = L"(";
+
+        expression += isInertiaFromImpulseExpression;
+        expression += L" ? ";
+        AppendPartitionExpression(expression, targetExpression, scale, s_impulseBoundary, 0, snapPointCount);
+        expression += L" : ";
+        AppendPartitionExpression(expression, targetExpression, scale, s_boundary, 0, snapPointCount);
+        expression += L") * ";
+        expression += scale;
+
+        cachedExpression = expressionCache.emplace(signature, winrt::hstring{ expression }).first;
+    }
+
+    m_restingValueExpressionAnimation = interactionTracker.Compositor().CreateExpressionAnimation(cachedExpression->second);
+
+    for (int index = 0; index < snapPointCount; index++)
+    {
+        SnapPointBase* snapPoint = SnapPointWrapper<T>::GetSnapPointFromWrapper(m_snapPointWrappers[index]);
+
+        m_restingValueExpressionAnimation.SetScalarParameter(GetParameterName(s_value, index), static_cast<float>(snapPoint->IrregularValue()));
+
+        if (index < snapPointCount - 1)
+        {
+            m_restingValueExpressionAnimation.SetScalarParameter(
+                GetParameterName(s_boundary, index),
+                static_cast<float>(std::get<1>(m_snapPointWrappers[index]->ActualApplicableZone())));
+        }
+    }
+
+    UpdateRestingPointExpressionAnimationForImpulse();
+    FirstSnapPoint()->UpdateExpressionAnimationForImpulse(m_restingValueExpressionAnimation, isInertiaFromImpulse);
+
+    return m_restingValueExpressionAnimation;
+}
+
+template<typename T>
+winrt::ExpressionAnimation CompositeSnapPointWrapper<T>::CreateConditionalExpression(
+    winrt::InteractionTracker const& interactionTracker,
+    winrt::hstring const& target,
+    winrt::hstring const& scale,
+    bool isInertiaFromImpulse,
+    CompositeSnapPointExpressionCache& expressionCache)
+{
+    const std::wstring signature = std::wstring(L"c|") + target.c_str() + L"|" + scale.c_str();
+    auto cachedExpression = expressionCache.find(signature);
+
+    if (cachedExpression == expressionCache.end())
+    {
+        SnapPointBase* snapPoint = FirstSnapPoint();
+        const winrt::hstring isInertiaFromImpulseExpression = snapPoint->GetIsInertiaFromImpulseExpression(L"this.Target");
+        const winrt::hstring targetExpression = snapPoint->GetTargetExpression(target);
+        const winrt::hstring expression = StringUtil::FormatString(
+            L"%1!s! ? (%2!s! >= (%5!s! * %7!s!) && %2!s! <= (%6!s! * %7!s!)) : (%2!s! >= (%3!s! * %7!s!) && %2!s! <= (%4!s! * %7!s!))",
+            isInertiaFromImpulseExpression.data(),
+            targetExpression.data(),
+            s_start.data(),
+            s_end.data(),
+            s_impulseStart.data(),
+            s_impulseEnd.data(),
+            scale.data());
+
+        cachedExpression = expressionCache.emplace(signature, expression).first;
+    }
+
+    m_conditionExpressionAnimation = interactionTracker.Compositor().CreateExpressionAnimation(cachedExpression->second);
+    m_conditionExpressionAnimation.SetScalarParameter(s_start, static_cast<float>(std::get<0>(m_snapPointWrappers.front()->ActualApplicableZone())));
+    m_conditionExpressionAnimation.SetScalarParameter(s_end, static_cast<float>(std::get<1>(m_snapPointWrappers.back()->ActualApplicableZone())));
+
+    UpdateConditionalExpressionAnimationForImpulse();
+    FirstSnapPoint()->UpdateExpressionAnimationForImpulse(m_conditionExpressionAnimation, isInertiaFromImpulse);
+
+    return m_conditionExpressionAnimation;
+}
+
+// Invoked when the InteractionTracker reaches the Idle State and a new ignored value may have to be set.
+template<typename T>
+std::tuple<winrt::ExpressionAnimation, winrt::ExpressionAnimation> CompositeSnapPointWrapper<T>::GetUpdatedExpressionAnimationsForImpulse()
+{
+    UpdateConditionalExpressionAnimationForImpulse();
+    UpdateRestingPointExpressionAnimationForImpulse();
+
+    return std::make_tuple(m_conditionExpressionAnimation, m_restingValueExpressionAnimation);
+}
+
+// Invoked on pre-RS5 versions when Scroller::m_isInertiaFromImpulse changed
+// and the 'iIFI' boolean parameters need to be updated.
+template<typename T>
+std::tuple<winrt::ExpressionAnimation, winrt::ExpressionAnimation> CompositeSnapPointWrapper<T>::GetUpdatedExpressionAnimationsForImpulse(
+    bool isInertiaFromImpulse)
+{
+    MUX_ASSERT(!SharedHelpers::IsRS5OrHigher());
+
+    SnapPointBase* snapPoint = FirstSnapPoint();
+
+    snapPoint->UpdateExpressionAnimationForImpulse(
+        m_conditionExpressionAnimation,
+        isInertiaFromImpulse);
+    snapPoint->UpdateExpressionAnimationForImpulse(
+        m_restingValueExpressionAnimation,
+        isInertiaFromImpulse);
+
+    return std::make_tuple(m_conditionExpressionAnimation, m_restingValueExpressionAnimation);
+}
+
+template<typename T>
+bool CompositeSnapPointWrapper<T>::IsComposable(SnapPointWrapper<T> const* snapPointWrapper)
+{
+    return !isnan(SnapPointWrapper<T>::GetSnapPointFromWrapper(snapPointWrapper)->IrregularValue());
+}
+
+template<typename T>
+bool CompositeSnapPointWrapper<T>::AreContiguous(SnapPointWrapper<T> const* previousSnapPointWrapper, SnapPointWrapper<T> const* nextSnapPointWrapper)
+{
+    return std::get<1>(previousSnapPointWrapper->ActualApplicableZone()) == std::get<0>(nextSnapPointWrapper->ActualApplicableZone()) &&
+        std::get<1>(previousSnapPointWrapper->ActualImpulseApplicableZone()) == std::get<0>(nextSnapPointWrapper->ActualImpulseApplicableZone());
+}
+
+template<typename T>
+SnapPointBase* CompositeSnapPointWrapper<T>::FirstSnapPoint() const
+{
+    return SnapPointWrapper<T>::GetSnapPointFromWrapper(m_snapPointWrappers.front());
+}
+
+template<typename T>
+void CompositeSnapPointWrapper<T>::UpdateConditionalExpressionAnimationForImpulse() const
+{
+    m_conditionExpressionAnimation.SetScalarParameter(s_impulseStart, static_cast<float>(std::get<0>(m_snapPointWrappers.front()->ActualImpulseApplicableZone())));
+    m_conditionExpressionAnimation.SetScalarParameter(s_impulseEnd, static_cast<float>(std::get<1>(m_snapPointWrappers.back()->ActualImpulseApplicableZone())));
+}
+
+template<typename T>
+void CompositeSnapPointWrapper<T>::UpdateRestingPointExpressionAnimationForImpulse() const
+{
+    for (int index = 0; index < SnapPointCount() - 1; index++)
+    {
+        m_restingValueExpressionAnimation.SetScalarParameter(
+            GetParameterName(s_impulseBoundary, index),
+            static_cast<float>(std::get<1>(m_snapPointWrappers[index]->ActualImpulseApplicableZone())));
+    }
+}
+
+// Appends the partition of the snap points [first, last) to the expression. A single snap point results in 'v<first>',
+// otherwise the range is split in two halves around the boundary that separates them: '(T <= (b<i> * scale) ? <lower> : <upper>)'.
+// A target on a boundary picks the lower snap point, like it picks the first matching inertia modifier.
+template<typename T>
+void CompositeSnapPointWrapper<T>::AppendPartitionExpression(
+    std::wstring& expression,
+    std::wstring_view const& targetExpression,
+    std::wstring_view const& scale,
+    std::wstring_view const& boundaryPrefix,
+    int first,
+    int last)
+{
+    MUX_ASSERT(first < last);
+
+    if (last - first == 1)
+    {
+        expression += GetParameterName(s_value, first);
+        return;
+    }
+
+    const int middle = first + (last - first) / 2;
+
+    expression += L"(";
+    expression += targetExpression;
+    expression += L" <= (";
+    expression += GetParameterName(boundaryPrefix, middle - 1);
+    expression += L" * ";
+    expression += scale;
+    expression += L") ? ";
+    AppendPartitionExpression(expression, targetExpression, scale, boundaryPrefix, first, middle);
+    expression += L" : ";
+    AppendPartitionExpression(expression, targetExpression, scale, boundaryPrefix, middle, last);
+    expression += L")";
+}
+
+template<typename T>
+std::wstring CompositeSnapPointWrapper<T>::GetParameterName(std::wstring_view const& prefix, int index)
+{
+    return std::wstring(prefix) + std::to_wstring(index);
+}
+
+template class CompositeSnapPointWrapper<winrt::ScrollSnapPointBase>;
+template class CompositeSnapPointWrapper<winrt::ZoomSnapPointBase>;
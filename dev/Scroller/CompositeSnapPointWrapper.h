@@ -0,0 +1,73 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "SnapPointWrapper.h"
+
+// Generated composite expression strings, keyed by a signature made of the expression kind,
+// the snap points count, the target and the scale.
+using CompositeSnapPointExpressionCache = std::map<std::wstring, winrt::hstring>;
+
+// The CompositeSnapPointWrapper class stands for a run of neighboring irregular snap points of a sorted and consolidated
+// snap points set, whose actual applicable zones are contiguous. Instead of one inertia modifier per snap point, the whole
+// run is handed to the InteractionTracker as a single modifier: its condition covers the union of the run's zones and its
+// resting value picks the snap point with a binary partition of the zone boundaries.
+
+template <typename T>
+class CompositeSnapPointWrapper
+{
+public:
+    CompositeSnapPointWrapper(std::vector<SnapPointWrapper<T>*> const& snapPointWrappers);
+
+    SnapPointWrapper<T>* First() const;
+    int SnapPointCount() const;
+
+    winrt::ExpressionAnimation CreateRestingPointExpression(
+        winrt::InteractionTracker const& interactionTracker,
+        winrt::hstring const& target,
+        winrt::hstring const& scale,
+        bool isInertiaFromImpulse,
+        CompositeSnapPointExpressionCache& expressionCache);
+    winrt::ExpressionAnimation CreateConditionalExpression(
+        winrt::InteractionTracker const& interactionTracker,
+        winrt::hstring const& target,
+        winrt::hstring const& scale,
+        bool isInertiaFromImpulse,
+        CompositeSnapPointExpressionCache& expressionCache);
+    std::tuple<winrt::ExpressionAnimation, winrt::ExpressionAnimation> GetUpdatedExpressionAnimationsForImpulse();
+    std::tuple<winrt::ExpressionAnimation, winrt::ExpressionAnimation> GetUpdatedExpressionAnimationsForImpulse(
+        bool isInertiaFromImpulse);
+
+    // Returns True when the snap point can be part of a composite, i.e. when it is irregular.
+    static bool IsComposable(SnapPointWrapper<T> const* snapPointWrapper);
+    // Returns True when the two neighboring snap points' actual applicable zones leave no gap between them.
+    static bool AreContiguous(SnapPointWrapper<T> const* previousSnapPointWrapper, SnapPointWrapper<T> const* nextSnapPointWrapper);
+
+private:
+    SnapPointBase* FirstSnapPoint() const;
+    void UpdateConditionalExpressionAnimationForImpulse() const;
+    void UpdateRestingPointExpressionAnimationForImpulse() const;
+
+    static void AppendPartitionExpression(
+        std::wstring& expression,
+        std::wstring_view const& targetExpression,
+        std::wstring_view const& scale,
+        std::wstring_view const& boundaryPrefix,
+        int first,
+        int last);
+    static std::wstring GetParameterName(std::wstring_view const& prefix, int index);
+
+    std::vector<SnapPointWrapper<T>*> m_snapPointWrappers;
+    winrt::ExpressionAnimation m_conditionExpressionAnimation{ nullptr };
+    winrt::ExpressionAnimation m_restingValueExpressionAnimation{ nullptr };
+
+    // Constants used in composition expressions
+    static constexpr std::wstring_view s_value{ L"v"sv };
+    static constexpr std::wstring_view s_boundary{ L"b"sv };
+    static constexpr std::wstring_view s_impulseBoundary{ L"ib"sv };
+    static constexpr std::wstring_view s_start{ L"stt"sv };
+    static constexpr std::wstring_view s_end{ L"end"sv };
+    static constexpr std::wstring_view s_impulseStart{ L"iStt"sv };
+    static constexpr std::wstring_view s_impulseEnd{ L"iEnd"sv };
+};
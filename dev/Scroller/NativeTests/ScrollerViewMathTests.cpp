@@ -0,0 +1,467 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+// Standalone tests for ScrollerViewMath and ScrollerViewSimulator, followed by a replay of scripted
+// interactions that reports their latency and the heap allocations they cause. Only depends on the
+// standard library, so it builds outside of the MUXControls solution, for instance with
+//   g++ -std=c++17 -O2 ScrollerViewMathTests.cpp ScrollerViewSimulator.cpp ../ScrollerViewMath.cpp
+//   cl /std:c++17 /EHsc /O2 ScrollerViewMathTests.cpp ScrollerViewSimulator.cpp ..\ScrollerViewMath.cpp
+// The process exit code is the number of failed checks.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <vector>
+#include "../ScrollerViewMath.h"
+#include "ScrollerViewSimulator.h"
+
+using namespace ScrollerViewMath;
+
+static std::atomic<uint64_t> s_allocationCount{ 0 };
+
+void* operator new(size_t size)
+{
+    s_allocationCount++;
+    if (void* block = std::malloc(size == 0 ? 1 : size))
+    {
+        return block;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept
+{
+    std::free(block);
+}
+
+void operator delete(void* block, size_t) noexcept
+{
+    std::free(block);
+}
+
+static int s_failedChecks = 0;
+
+static void Check(bool condition, const char* expression, int line)
+{
+    if (!condition)
+    {
+        std::printf("FAILED line %d: %s\n", line, expression);
+        s_failedChecks++;
+    }
+}
+
+#define CHECK(condition) Check((condition), #condition, __LINE__)
+#define CHECK_NEAR(actual, expected, tolerance) Check(std::abs((actual) - (expected)) <= (tolerance), #actual " ~= " #expected, __LINE__)
+
+static constexpr double s_frameDuration{ 1.0 / 60.0 };
+static constexpr float s_snapInterval{ 100.0f };
+
+// Mandatory repeated snap points every s_snapInterval pixels, like a RepeatedScrollSnapPoint with an infinite applicable range.
+static std::vector<TrackerInertiaModifier> CreateRepeatedSnapPointModifiers()
+{
+    TrackerInertiaModifier modifier;
+
+    modifier.Condition = [](float) { return true; };
+    modifier.RestingValue = [](float naturalRestingPosition) { return std::round(naturalRestingPosition / s_snapInterval) * s_snapInterval; };
+    return { modifier };
+}
+
+// Ticks the simulator until it is idle and returns the number of ticks.
+static int TickUntilIdle(ScrollerViewSimulator& simulator)
+{
+    int ticks = 0;
+
+    do
+    {
+        simulator.Tick(s_frameDuration);
+        ticks++;
+    }
+    while (!simulator.IsIdle() && ticks < 100000);
+
+    return ticks;
+}
+
+static void ComputeMinMaxPositionTests()
+{
+    float minPosition = std::numeric_limits<float>::quiet_NaN();
+    float maxPosition = std::numeric_limits<float>::quiet_NaN();
+
+    ComputeMinMaxPosition(ContentAlignment::Start, 1000.0f, 400.0f, 1.0f, &minPosition, &maxPosition);
+    CHECK(minPosition == 0.0f);
+    CHECK(maxPosition == 0.0f);
+
+    // Content smaller than the viewport stays centered.
+    ComputeMinMaxPosition(ContentAlignment::Center, 200.0f, 400.0f, 1.0f, &minPosition, &maxPosition);
+    CHECK(minPosition == -100.0f);
+    CHECK(maxPosition == -100.0f);
+
+    ComputeMinMaxPosition(ContentAlignment::Center, 1000.0f, 400.0f, 2.0f, &minPosition, &maxPosition);
+    CHECK(minPosition == 0.0f);
+    CHECK(maxPosition == 1600.0f);
+
+    ComputeMinMaxPosition(ContentAlignment::End, 200.0f, 400.0f, 1.0f, &minPosition, &maxPosition);
+    CHECK(minPosition == -200.0f);
+    CHECK(maxPosition == 200.0f);
+
+    ComputeMinMaxPosition(ContentAlignment::End, 200.0f, 400.0f, 4.0f, &minPosition, nullptr);
+    CHECK(minPosition == 0.0f);
+}
+
+static void ComputeZoomedOffsetWithMinimalChangeTests()
+{
+    // Above the viewport and smaller: align the top edges.
+    CHECK(ComputeZoomedOffsetWithMinimalChange(100.0, 500.0, 50.0, 150.0) == 50.0);
+    // Above the viewport and larger: align the bottom edges.
+    CHECK(ComputeZoomedOffsetWithMinimalChange(100.0, 500.0, 0.0, 450.0) == 50.0);
+    // Below the viewport and smaller: align the bottom edges.
+    CHECK(ComputeZoomedOffsetWithMinimalChange(100.0, 500.0, 600.0, 700.0) == 300.0);
+    // Below the viewport and larger: align the top edges.
+    CHECK(ComputeZoomedOffsetWithMinimalChange(100.0, 500.0, 200.0, 700.0) == 200.0);
+    // Within or spanning the viewport: no change.
+    CHECK(ComputeZoomedOffsetWithMinimalChange(100.0, 500.0, 200.0, 300.0) == 100.0);
+    CHECK(ComputeZoomedOffsetWithMinimalChange(100.0, 500.0, 0.0, 600.0) == 100.0);
+}
+
+static void ApplyAlignmentRatioTests()
+{
+    double targetStart = 100.0;
+    double targetLength = 50.0;
+
+    ApplyAlignmentRatio(std::numeric_limits<double>::quiet_NaN(), 400.0, 2.0, &targetStart, &targetLength);
+    CHECK(targetStart == 100.0);
+    CHECK(targetLength == 50.0);
+
+    // The 200 unzoomed pixels of viewport are centered on the 50 pixel target.
+    ApplyAlignmentRatio(0.5, 400.0, 2.0, &targetStart, &targetLength);
+    CHECK(targetStart == 25.0);
+    CHECK(targetLength == 200.0);
+
+    targetStart = 100.0;
+    targetLength = 50.0;
+    ApplyAlignmentRatio(1.0, 400.0, 1.0, &targetStart, &targetLength);
+    CHECK(targetStart == -250.0);
+    CHECK(targetLength == 400.0);
+}
+
+static void ComputeBringIntoViewTargetOffsetTests()
+{
+    double appliedOffset = -1.0;
+
+    CHECK(ComputeBringIntoViewTargetOffset(0.0, 400.0, 1.0, 600.0, 800.0, 50.0, 0.0, &appliedOffset) == 450.0);
+    CHECK(appliedOffset == 0.0);
+
+    // The requested offset is entirely applied while it remains within bounds...
+    CHECK(ComputeBringIntoViewTargetOffset(0.0, 400.0, 1.0, 600.0, 800.0, 50.0, 100.0, &appliedOffset) == 350.0);
+    CHECK(appliedOffset == 100.0);
+
+    // ...and only partially past the boundary.
+    CHECK(ComputeBringIntoViewTargetOffset(0.0, 400.0, 1.0, 600.0, 800.0, 50.0, -300.0, &appliedOffset) == 600.0);
+    CHECK(appliedOffset == -150.0);
+
+    // Targets past the extent are clamped to the scrollable size.
+    CHECK(ComputeBringIntoViewTargetOffset(0.0, 400.0, 1.0, 600.0, 950.0, 100.0, 0.0, &appliedOffset) == 600.0);
+
+    // Zoomed target.
+    CHECK(ComputeBringIntoViewTargetOffset(0.0, 400.0, 2.0, 1600.0, 300.0, 50.0, 0.0, &appliedOffset) == 300.0);
+}
+
+static void SimulatorBoundariesTests()
+{
+    ScrollerViewSimulator simulator(ContentAlignment::Start, ContentAlignment::Start, { 1000.0f, 5000.0f }, { 400.0f, 600.0f });
+    int completedRequestId = 0;
+    bool wasInterrupted = true;
+
+    simulator.RequestCompleted([&](int requestId, bool interrupted) { completedRequestId = requestId; wasInterrupted = interrupted; });
+
+    CHECK(simulator.MinPosition().X == 0.0f && simulator.MinPosition().Y == 0.0f);
+    CHECK(simulator.MaxPosition().X == 600.0f && simulator.MaxPosition().Y == 4400.0f);
+
+    const int requestId = simulator.TryUpdatePosition({ 100.0f, 5000.0f });
+
+    // Requests only take effect on the next tick.
+    CHECK(!simulator.IsIdle());
+    CHECK(simulator.Position().Y == 0.0f);
+    simulator.Tick(s_frameDuration);
+    CHECK(simulator.IsIdle());
+    CHECK(completedRequestId == requestId);
+    CHECK(!wasInterrupted);
+    CHECK(simulator.Position().X == 100.0f);
+    CHECK(simulator.Position().Y == 4400.0f);
+
+    simulator.TryUpdatePositionBy({ -500.0f, -400.0f });
+    simulator.Tick(s_frameDuration);
+    CHECK(simulator.Position().X == 0.0f);
+    CHECK(simulator.Position().Y == 4000.0f);
+
+    // Shrinking the extent pulls the position back within the new boundaries.
+    simulator.UnzoomedExtent({ 1000.0f, 2000.0f });
+    CHECK(simulator.Position().Y == 1400.0f);
+}
+
+static void SimulatorInertiaTests()
+{
+    ScrollerViewSimulator simulator(ContentAlignment::Start, ContentAlignment::Start, { 400.0f, 5000.0f }, { 400.0f, 600.0f });
+    int completedRequestId = 0;
+    bool wasInterrupted = false;
+
+    simulator.RequestCompleted([&](int requestId, bool interrupted) { completedRequestId = requestId; wasInterrupted = interrupted; });
+
+    // With the default 0.95 decay rate the content travels -v0 / ln(0.05) pixels.
+    int requestId = simulator.TryUpdatePositionWithAdditionalVelocity({ 0.0f, 1000.0f });
+    const int ticks = TickUntilIdle(simulator);
+
+    CHECK(completedRequestId == requestId);
+    CHECK(!wasInterrupted);
+    CHECK_NEAR(simulator.Position().Y, static_cast<float>(-1000.0 / std::log(0.05)), 0.001f);
+    // The last 0.01 pixel is reached after ln(0.01 / 333.8) / ln(0.05) = 3.47s.
+    CHECK(ticks == 209);
+
+    // Same fling with mandatory snap points: 333.8 + 333.8 rests on 700.
+    simulator.InertiaModifiers(TrackerDimension::Vertical, CreateRepeatedSnapPointModifiers());
+    requestId = simulator.TryUpdatePositionWithAdditionalVelocity({ 0.0f, 1000.0f });
+    TickUntilIdle(simulator);
+    CHECK(completedRequestId == requestId);
+    CHECK(simulator.Position().Y == 700.0f);
+
+    // A fling past the end rests on MaxPosition even though it is not a snap point.
+    simulator.TryUpdatePositionWithAdditionalVelocity({ 0.0f, 100000.0f });
+    TickUntilIdle(simulator);
+    CHECK(simulator.Position().Y == 4400.0f);
+
+    // A new request interrupts the inertia, which completes before the new request does.
+    std::vector<std::pair<int, bool>> completions;
+
+    simulator.RequestCompleted([&](int requestId, bool interrupted) { completions.emplace_back(requestId, interrupted); });
+
+    const int flingRequestId = simulator.TryUpdatePositionWithAdditionalVelocity({ 0.0f, -1000.0f });
+
+    simulator.Tick(s_frameDuration);
+    simulator.Tick(s_frameDuration);
+
+    const float flingPosition = simulator.Position().Y;
+    const int jumpRequestId = simulator.TryUpdatePositionBy({ 0.0f, -10.0f });
+
+    simulator.Tick(s_frameDuration);
+    CHECK(simulator.IsIdle());
+    CHECK(completions.size() == 2);
+    CHECK(completions[0] == std::make_pair(flingRequestId, true));
+    CHECK(completions[1] == std::make_pair(jumpRequestId, false));
+    CHECK(flingPosition < 4400.0f);
+    CHECK(simulator.Position().Y == flingPosition - 10.0f);
+}
+
+static void SimulatorScaleTests()
+{
+    ScrollerViewSimulator simulator(ContentAlignment::Center, ContentAlignment::Center, { 200.0f, 200.0f }, { 400.0f, 400.0f });
+
+    // Content smaller than the viewport is centered.
+    CHECK(simulator.Position().X == -100.0f && simulator.Position().Y == -100.0f);
+
+    // Zooming around the viewport center keeps the content centered.
+    simulator.TryUpdateScale(4.0f, { 200.0f, 200.0f });
+    simulator.Tick(s_frameDuration);
+    CHECK(simulator.Scale() == 4.0f);
+    CHECK(simulator.MinPosition().X == 0.0f && simulator.MaxPosition().X == 400.0f);
+    CHECK(simulator.Position().X == 200.0f && simulator.Position().Y == 200.0f);
+
+    // Zooming around the top-left corner keeps that point still.
+    simulator.TryUpdateScale(2.0f, { 0.0f, 0.0f });
+    simulator.Tick(s_frameDuration);
+    CHECK(simulator.Position().X == 0.0f && simulator.Position().Y == 0.0f);
+    CHECK(simulator.MaxPosition().X == 0.0f);
+
+    // The scale is clamped to its boundaries.
+    simulator.TryUpdateScale(50.0f, { 0.0f, 0.0f });
+    simulator.Tick(s_frameDuration);
+    CHECK(simulator.Scale() == 10.0f);
+}
+
+struct ReplayResults
+{
+    int interactions;
+    int ticks;
+    std::vector<int> latenciesInTicks;
+    std::vector<double> durationsInMicroseconds;
+    uint64_t allocations;
+    double checksum;
+};
+
+// Deterministic linear congruential generator so replays are identical from run to run.
+class ReplayRandom
+{
+public:
+    uint32_t Next()
+    {
+        m_state = m_state * 1664525u + 1013904223u;
+        return m_state >> 8;
+    }
+
+    float NextInRange(float minimum, float maximum)
+    {
+        return minimum + (maximum - minimum) * static_cast<float>(Next() % 100001u) / 100000.0f;
+    }
+
+private:
+    uint32_t m_state{ 12345u };
+};
+
+// Scripted mix of the Scroller's view changes: absolute and relative offset changes, flings resting on
+// snap points, zoom factor changes and bring-into-view requests, each ticked at 60fps until idle.
+static ReplayResults Replay(int interactions)
+{
+    constexpr TrackerVector unzoomedExtent{ 2000.0f, 50000.0f };
+    constexpr TrackerVector viewport{ 800.0f, 600.0f };
+
+    ScrollerViewSimulator simulator(ContentAlignment::Center, ContentAlignment::Start, unzoomedExtent, viewport);
+    ReplayRandom random;
+    ReplayResults results{ interactions, 0, {}, {}, 0, 0.0 };
+    int completedRequestId = 0;
+
+    simulator.ScaleBoundaries(0.5f, 4.0f);
+    simulator.InertiaModifiers(TrackerDimension::Vertical, CreateRepeatedSnapPointModifiers());
+    simulator.RequestCompleted([&completedRequestId](int requestId, bool) { completedRequestId = requestId; });
+    results.latenciesInTicks.reserve(interactions);
+    results.durationsInMicroseconds.reserve(interactions);
+
+    const uint64_t allocationsBeforeReplay = s_allocationCount;
+
+    for (int interaction = 0; interaction < interactions; interaction++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const uint32_t kind = random.Next() % 5;
+        int requestId = 0;
+
+        switch (kind)
+        {
+        case 0:
+            requestId = simulator.TryUpdatePosition({ random.NextInRange(-100.0f, 8000.0f), random.NextInRange(-100.0f, 200000.0f) });
+            break;
+        case 1:
+            requestId = simulator.TryUpdatePositionBy({ random.NextInRange(-500.0f, 500.0f), random.NextInRange(-2000.0f, 2000.0f) });
+            break;
+        case 2:
+            requestId = simulator.TryUpdatePositionWithAdditionalVelocity({ 0.0f, random.NextInRange(-6000.0f, 6000.0f) });
+            break;
+        case 3:
+            requestId = simulator.TryUpdateScale(random.NextInRange(0.25f, 5.0f), { random.NextInRange(0.0f, viewport.X), random.NextInRange(0.0f, viewport.Y) });
+            break;
+        default:
+        {
+            const double zoomFactor = simulator.Scale();
+            double targetStart = random.NextInRange(0.0f, unzoomedExtent.Y - 100.0f);
+            double targetLength = 100.0;
+            double appliedOffset = 0.0;
+
+            ApplyAlignmentRatio(random.Next() % 2 ? 0.5 : std::numeric_limits<double>::quiet_NaN(), viewport.Y, zoomFactor, &targetStart, &targetLength);
+
+            const double targetOffset = ComputeBringIntoViewTargetOffset(
+                simulator.Position().Y,
+                viewport.Y,
+                zoomFactor,
+                std::max(0.0, unzoomedExtent.Y * zoomFactor - viewport.Y),
+                targetStart,
+                targetLength,
+                0.0 /*requestedOffset*/,
+                &appliedOffset);
+
+            requestId = simulator.TryUpdatePosition({ simulator.Position().X, static_cast<float>(targetOffset) });
+            break;
+        }
+        }
+
+        int latencyInTicks = 0;
+
+        do
+        {
+            simulator.Tick(s_frameDuration);
+            latencyInTicks++;
+
+            const TrackerVector position = simulator.Position();
+
+            CHECK(position.X >= simulator.MinPosition().X && position.X <= simulator.MaxPosition().X);
+            CHECK(position.Y >= simulator.MinPosition().Y && position.Y <= simulator.MaxPosition().Y);
+        }
+        while (!simulator.IsIdle());
+
+        const auto end = std::chrono::steady_clock::now();
+
+        CHECK(completedRequestId == requestId);
+        if (kind == 2)
+        {
+            // Flings rest on a snap point, or on a boundary.
+            const float restingPosition = simulator.Position().Y;
+
+            CHECK(std::fmod(restingPosition, s_snapInterval) == 0.0f || restingPosition == simulator.MaxPosition().Y);
+        }
+
+        results.ticks += latencyInTicks;
+        results.latenciesInTicks.push_back(latencyInTicks);
+        results.durationsInMicroseconds.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        results.checksum += simulator.Position().X + simulator.Position().Y + simulator.Scale();
+    }
+
+    results.allocations = s_allocationCount - allocationsBeforeReplay;
+    return results;
+}
+
+template <typename T>
+static T Percentile(std::vector<T> values, double percentile)
+{
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, static_cast<size_t>(percentile * values.size()))];
+}
+
+static void ReplayTests()
+{
+    constexpr int interactions = 10000;
+
+    const ReplayResults results = Replay(interactions);
+    const ReplayResults secondResults = Replay(interactions);
+
+    // The simulation does not depend on the time it takes to run.
+    CHECK(results.checksum == secondResults.checksum);
+    CHECK(results.ticks == secondResults.ticks);
+    CHECK(results.latenciesInTicks == secondResults.latenciesInTicks);
+
+    // Steady-state view changes do not allocate.
+    CHECK(results.allocations == 0);
+
+    double totalMicroseconds = 0.0;
+
+    for (double duration : results.durationsInMicroseconds)
+    {
+        totalMicroseconds += duration;
+    }
+
+    std::printf("Replayed %d interactions in %d ticks:\n", results.interactions, results.ticks);
+    std::printf("  latency (ms at 60fps): p50 %.1f, p99 %.1f, max %.1f\n",
+        Percentile(results.latenciesInTicks, 0.5) * s_frameDuration * 1000.0,
+        Percentile(results.latenciesInTicks, 0.99) * s_frameDuration * 1000.0,
+        Percentile(results.latenciesInTicks, 1.0) * s_frameDuration * 1000.0);
+    std::printf("  CPU time per interaction (us): p50 %.2f, p99 %.2f, per tick %.3f\n",
+        Percentile(results.durationsInMicroseconds, 0.5),
+        Percentile(results.durationsInMicroseconds, 0.99),
+        totalMicroseconds / results.ticks);
+    std::printf("  heap allocations: %llu\n", static_cast<unsigned long long>(results.allocations));
+}
+
+int main()
+{
+    ComputeMinMaxPositionTests();
+    ComputeZoomedOffsetWithMinimalChangeTests();
+    ApplyAlignmentRatioTests();
+    ComputeBringIntoViewTargetOffsetTests();
+    SimulatorBoundariesTests();
+    SimulatorInertiaTests();
+    SimulatorScaleTests();
+    ReplayTests();
+
+    std::printf(s_failedChecks == 0 ? "All checks passed.\n" : "%d check(s) failed.\n", s_failedChecks);
+    return s_failedChecks;
+}
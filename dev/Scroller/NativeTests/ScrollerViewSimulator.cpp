@@ -0,0 +1,256 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include "ScrollerViewSimulator.h"
+
+namespace ScrollerViewMath
+{
+
+ScrollerViewSimulator::ScrollerViewSimulator(
+    ContentAlignment horizontalAlignment,
+    ContentAlignment verticalAlignment,
+    TrackerVector unzoomedExtent,
+    TrackerVector viewport)
+    : m_horizontalAlignment(horizontalAlignment)
+    , m_verticalAlignment(verticalAlignment)
+    , m_unzoomedExtent(unzoomedExtent)
+    , m_viewport(viewport)
+{
+    m_pendingRequests.reserve(s_pendingRequestsCapacity);
+    UpdateBoundaries();
+    ClampPosition();
+}
+
+bool ScrollerViewSimulator::IsIdle() const
+{
+    return !m_isInInertia && m_pendingRequests.empty();
+}
+
+void ScrollerViewSimulator::PositionInertiaDecayRate(float decayRate)
+{
+    assert(decayRate > 0.0f && decayRate < 1.0f);
+
+    m_positionInertiaDecayRate = decayRate;
+}
+
+void ScrollerViewSimulator::InertiaModifiers(TrackerDimension dimension, std::vector<TrackerInertiaModifier> modifiers)
+{
+    (dimension == TrackerDimension::Horizontal ? m_horizontalModifiers : m_verticalModifiers) = std::move(modifiers);
+}
+
+int ScrollerViewSimulator::TryUpdatePosition(TrackerVector position)
+{
+    return QueueRequest(RequestKind::Position, position, 0.0f);
+}
+
+int ScrollerViewSimulator::TryUpdatePositionBy(TrackerVector delta)
+{
+    return QueueRequest(RequestKind::PositionBy, delta, 0.0f);
+}
+
+int ScrollerViewSimulator::TryUpdatePositionWithAdditionalVelocity(TrackerVector velocity)
+{
+    return QueueRequest(RequestKind::AdditionalVelocity, velocity, 0.0f);
+}
+
+int ScrollerViewSimulator::TryUpdateScale(float scale, TrackerVector centerPoint)
+{
+    return QueueRequest(RequestKind::Scale, centerPoint, scale);
+}
+
+void ScrollerViewSimulator::ScaleBoundaries(float minScale, float maxScale)
+{
+    assert(minScale > 0.0f && minScale <= maxScale);
+
+    m_minScale = minScale;
+    m_maxScale = maxScale;
+    m_scale = std::clamp(m_scale, m_minScale, m_maxScale);
+    UpdateBoundaries();
+    ClampPosition();
+}
+
+void ScrollerViewSimulator::UnzoomedExtent(TrackerVector unzoomedExtent)
+{
+    m_unzoomedExtent = unzoomedExtent;
+    UpdateBoundaries();
+    ClampPosition();
+}
+
+void ScrollerViewSimulator::Viewport(TrackerVector viewport)
+{
+    m_viewport = viewport;
+    UpdateBoundaries();
+    ClampPosition();
+}
+
+void ScrollerViewSimulator::Tick(double seconds)
+{
+    assert(seconds >= 0.0);
+
+    // Requests queued by the completion callbacks are left for the next tick.
+    const size_t pendingRequestsCount = m_pendingRequests.size();
+
+    for (size_t requestIndex = 0; requestIndex < pendingRequestsCount; requestIndex++)
+    {
+        ProcessRequest(m_pendingRequests[requestIndex]);
+    }
+    m_pendingRequests.erase(m_pendingRequests.begin(), m_pendingRequests.begin() + pendingRequestsCount);
+
+    if (!m_isInInertia)
+    {
+        return;
+    }
+
+    m_inertiaElapsed += seconds;
+
+    // The velocity decays as v0 * k^t with k = 1 - decayRate, so the covered fraction of the
+    // distance to the resting position is 1 - k^t.
+    const double remainingRatio = std::pow(1.0 - static_cast<double>(m_positionInertiaDecayRate), m_inertiaElapsed);
+    const float remainingX = static_cast<float>((m_horizontalInertia.restingPosition - m_horizontalInertia.start) * remainingRatio);
+    const float remainingY = static_cast<float>((m_verticalInertia.restingPosition - m_verticalInertia.start) * remainingRatio);
+
+    if (std::abs(remainingX) < s_inertiaRestingThreshold && std::abs(remainingY) < s_inertiaRestingThreshold)
+    {
+        m_position = { m_horizontalInertia.restingPosition, m_verticalInertia.restingPosition };
+        StopInertia(false /*interrupted*/);
+    }
+    else
+    {
+        m_position = { m_horizontalInertia.restingPosition - remainingX, m_verticalInertia.restingPosition - remainingY };
+    }
+}
+
+int ScrollerViewSimulator::QueueRequest(RequestKind kind, TrackerVector value, float scale)
+{
+    const int requestId = ++m_lastRequestId;
+
+    m_pendingRequests.push_back({ requestId, kind, value, scale });
+    return requestId;
+}
+
+void ScrollerViewSimulator::ProcessRequest(const Request& request)
+{
+    if (m_isInInertia)
+    {
+        StopInertia(true /*interrupted*/);
+    }
+
+    switch (request.kind)
+    {
+    case RequestKind::Position:
+        m_position = request.value;
+        ClampPosition();
+        break;
+    case RequestKind::PositionBy:
+        m_position = { m_position.X + request.value.X, m_position.Y + request.value.Y };
+        ClampPosition();
+        break;
+    case RequestKind::AdditionalVelocity:
+        StartInertia(request.id, request.value);
+        // Completion is raised when the inertia ends.
+        return;
+    case RequestKind::Scale:
+    {
+        const float oldScale = m_scale;
+
+        m_scale = std::clamp(request.scale, m_minScale, m_maxScale);
+
+        // Keep the content point under centerPoint at the same viewport location.
+        const float scaleRatio = m_scale / oldScale;
+
+        m_position = {
+            (m_position.X + request.value.X) * scaleRatio - request.value.X,
+            (m_position.Y + request.value.Y) * scaleRatio - request.value.Y };
+        UpdateBoundaries();
+        ClampPosition();
+        break;
+    }
+    }
+
+    CompleteRequest(request.id, false /*interrupted*/);
+}
+
+void ScrollerViewSimulator::StartInertia(int requestId, TrackerVector velocity)
+{
+    m_isInInertia = true;
+    m_inertiaRequestId = requestId;
+    m_inertiaElapsed = 0.0;
+    m_horizontalInertia = { m_position.X, ComputeRestingPosition(TrackerDimension::Horizontal, m_position.X, velocity.X) };
+    m_verticalInertia = { m_position.Y, ComputeRestingPosition(TrackerDimension::Vertical, m_position.Y, velocity.Y) };
+}
+
+void ScrollerViewSimulator::StopInertia(bool interrupted)
+{
+    assert(m_isInInertia);
+
+    m_isInInertia = false;
+    CompleteRequest(m_inertiaRequestId, interrupted);
+}
+
+void ScrollerViewSimulator::CompleteRequest(int requestId, bool interrupted)
+{
+    if (m_requestCompleted)
+    {
+        m_requestCompleted(requestId, interrupted);
+    }
+}
+
+void ScrollerViewSimulator::UpdateBoundaries()
+{
+    ComputeBoundaries(m_horizontalAlignment, m_unzoomedExtent.X, m_viewport.X, &m_minPosition.X, &m_maxPosition.X);
+    ComputeBoundaries(m_verticalAlignment, m_unzoomedExtent.Y, m_viewport.Y, &m_minPosition.Y, &m_maxPosition.Y);
+}
+
+void ScrollerViewSimulator::ClampPosition()
+{
+    m_position = {
+        std::clamp(m_position.X, m_minPosition.X, m_maxPosition.X),
+        std::clamp(m_position.Y, m_minPosition.Y, m_maxPosition.Y) };
+}
+
+float ScrollerViewSimulator::ComputeRestingPosition(TrackerDimension dimension, float position, float velocity) const
+{
+    // Integrating v0 * k^t over [0, infinity) gives -v0 / ln(k).
+    const double decayBase = 1.0 - static_cast<double>(m_positionInertiaDecayRate);
+    float restingPosition = static_cast<float>(position - velocity / std::log(decayBase));
+
+    for (const auto& modifier : dimension == TrackerDimension::Horizontal ? m_horizontalModifiers : m_verticalModifiers)
+    {
+        if (modifier.Condition(restingPosition))
+        {
+            restingPosition = modifier.RestingValue(restingPosition);
+            break;
+        }
+    }
+
+    return dimension == TrackerDimension::Horizontal ?
+        std::clamp(restingPosition, m_minPosition.X, m_maxPosition.X) :
+        std::clamp(restingPosition, m_minPosition.Y, m_maxPosition.Y);
+}
+
+// Mirrors Scroller::GetMinPositionXExpression/GetMaxPositionXExpression without the Content's layout offset.
+// The minimum comes from ScrollerViewMath::ComputeMinMaxPosition, as for the Scroller's idle anchoring.
+void ScrollerViewSimulator::ComputeBoundaries(ContentAlignment alignment, float unzoomedExtent, float viewport, float* minPosition, float* maxPosition) const
+{
+    const float scrollable = unzoomedExtent * m_scale - viewport;
+
+    ComputeMinMaxPosition(alignment, unzoomedExtent, viewport, m_scale, minPosition, nullptr);
+
+    switch (alignment)
+    {
+    case ContentAlignment::Start:
+        *maxPosition = std::max(0.0f, scrollable);
+        break;
+    case ContentAlignment::Center:
+        *maxPosition = scrollable >= 0.0f ? scrollable : scrollable / 2.0f;
+        break;
+    case ContentAlignment::End:
+        *maxPosition = scrollable;
+        break;
+    }
+}
+
+}
@@ -0,0 +1,116 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include <functional>
+#include <vector>
+#include "../ScrollerViewMath.h"
+#include "../ScrollerViewTracker.h"
+
+namespace ScrollerViewMath
+{
+    // Deterministic CPU stand-in for the InteractionTracker driven by the Scroller:
+    // - requests queue up and are processed on the next Tick, in order, like a Composition frame picks them up,
+    // - Min/MaxPosition follow the same expressions as Scroller::GetMinPositionExpression/GetMaxPositionExpression,
+    // - inertia decays the velocity by PositionInertiaDecayRate per second and lands on the natural resting
+    //   position, or on the value of the first inertia modifier whose condition accepts it, clamped to the boundaries,
+    // - a new request interrupts a running inertia, which then completes with its own request id.
+    // No time source is consulted: the position only depends on the requests and on the Tick durations.
+    class ScrollerViewSimulator final : public ScrollerViewTracker
+    {
+    public:
+        using RequestCompletedCallback = std::function<void(int requestId, bool interrupted)>;
+
+        ScrollerViewSimulator(
+            ContentAlignment horizontalAlignment,
+            ContentAlignment verticalAlignment,
+            TrackerVector unzoomedExtent,
+            TrackerVector viewport);
+
+        TrackerVector Position() const override { return m_position; }
+        float Scale() const override { return m_scale; }
+        TrackerVector MinPosition() const override { return m_minPosition; }
+        TrackerVector MaxPosition() const override { return m_maxPosition; }
+        bool IsIdle() const override;
+
+        void PositionInertiaDecayRate(float decayRate) override;
+        void InertiaModifiers(TrackerDimension dimension, std::vector<TrackerInertiaModifier> modifiers) override;
+
+        int TryUpdatePosition(TrackerVector position) override;
+        int TryUpdatePositionBy(TrackerVector delta) override;
+        int TryUpdatePositionWithAdditionalVelocity(TrackerVector velocity) override;
+        int TryUpdateScale(float scale, TrackerVector centerPoint) override;
+
+        void ScaleBoundaries(float minScale, float maxScale);
+        void UnzoomedExtent(TrackerVector unzoomedExtent);
+        void Viewport(TrackerVector viewport);
+        TrackerVector Viewport() const { return m_viewport; }
+        void RequestCompleted(RequestCompletedCallback callback) { m_requestCompleted = std::move(callback); }
+
+        // Processes the queued requests and advances a running inertia by the provided duration.
+        void Tick(double seconds);
+
+    private:
+        enum class RequestKind
+        {
+            Position,
+            PositionBy,
+            AdditionalVelocity,
+            Scale
+        };
+
+        struct Request
+        {
+            int id;
+            RequestKind kind;
+            TrackerVector value;
+            float scale;
+        };
+
+        struct InertiaDimension
+        {
+            float start;
+            float restingPosition;
+        };
+
+        int QueueRequest(RequestKind kind, TrackerVector value, float scale);
+        void ProcessRequest(const Request& request);
+        void StartInertia(int requestId, TrackerVector velocity);
+        void StopInertia(bool interrupted);
+        void CompleteRequest(int requestId, bool interrupted);
+        void UpdateBoundaries();
+        void ClampPosition();
+        float ComputeRestingPosition(TrackerDimension dimension, float position, float velocity) const;
+        void ComputeBoundaries(ContentAlignment alignment, float unzoomedExtent, float viewport, float* minPosition, float* maxPosition) const;
+
+        ContentAlignment m_horizontalAlignment;
+        ContentAlignment m_verticalAlignment;
+        TrackerVector m_unzoomedExtent;
+        TrackerVector m_viewport;
+        TrackerVector m_position{};
+        TrackerVector m_minPosition{};
+        TrackerVector m_maxPosition{};
+        float m_scale{ 1.0f };
+        float m_minScale{ 0.1f };
+        float m_maxScale{ 10.0f };
+        // Same default as InteractionTracker.PositionInertiaDecayRate.
+        float m_positionInertiaDecayRate{ 0.95f };
+        std::vector<TrackerInertiaModifier> m_horizontalModifiers;
+        std::vector<TrackerInertiaModifier> m_verticalModifiers;
+        std::vector<Request> m_pendingRequests;
+        RequestCompletedCallback m_requestCompleted;
+        int m_lastRequestId{ 0 };
+
+        bool m_isInInertia{ false };
+        int m_inertiaRequestId{ 0 };
+        double m_inertiaElapsed{ 0.0 };
+        InertiaDimension m_horizontalInertia{};
+        InertiaDimension m_verticalInertia{};
+
+        // Inertia ends once less than this many pixels remain to travel in both dimensions.
+        static constexpr float s_inertiaRestingThreshold{ 0.01f };
+        // Pending request count that never requires growing m_pendingRequests in practice.
+        static constexpr size_t s_pendingRequestsCapacity{ 16 };
+    };
+}
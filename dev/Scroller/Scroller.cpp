@@ -13,6 +13,7 @@
 #include "ZoomOptions.h"
 #include "ScrollerAutomationPeer.h"
 #include "ScrollerTestHooks.h"
+#include "ScrollerViewMath.h"
 #include "Vector.h"
 
 // Change to 'true' to turn on debugging outputs in Output window
@@ -926,6 +927,8 @@ winrt::Size Scroller::ArrangeOverride(winrt::Size const& finalSize)
     // support is not available. This is to provide downlevel support.
     if (SharedHelpers::IsRS5OrHigher())
     {
+        // The arrange pass may have moved the anchor candidates.
+        m_anchorCandidateIndex.InvalidateLayouts();
         m_isAnchorElementDirty = true;
     }
     else
@@ -1286,105 +1289,34 @@ void Scroller::ComputeMinMaxPositions(float zoomFactor, _Out_opt_ winrt::float2*
         return;
     }
 
-    const winrt::Visual scrollerVisual = winrt::ElementCompositionPreview::GetElementVisual(*this);
+    const winrt::float2 scrollerSize = winrt::ElementCompositionPreview::GetElementVisual(*this).Size();
+    const ScrollerViewMath::ContentAlignment horizontalAlignment =
+        contentAsFE.HorizontalAlignment() == winrt::HorizontalAlignment::Center || contentAsFE.HorizontalAlignment() == winrt::HorizontalAlignment::Stretch ?
+        ScrollerViewMath::ContentAlignment::Center :
+        (contentAsFE.HorizontalAlignment() == winrt::HorizontalAlignment::Right ? ScrollerViewMath::ContentAlignment::End : ScrollerViewMath::ContentAlignment::Start);
+    const ScrollerViewMath::ContentAlignment verticalAlignment =
+        contentAsFE.VerticalAlignment() == winrt::VerticalAlignment::Center || contentAsFE.VerticalAlignment() == winrt::VerticalAlignment::Stretch ?
+        ScrollerViewMath::ContentAlignment::Center :
+        (contentAsFE.VerticalAlignment() == winrt::VerticalAlignment::Bottom ? ScrollerViewMath::ContentAlignment::End : ScrollerViewMath::ContentAlignment::Start);
     float minPosX = 0.0f;
     float minPosY = 0.0f;
     float maxPosX = 0.0f;
     float maxPosY = 0.0f;
-    float extentWidth = static_cast<float>(m_unzoomedExtentWidth);
-    float extentHeight = static_cast<float>(m_unzoomedExtentHeight);
-
-    if (contentAsFE.HorizontalAlignment() == winrt::HorizontalAlignment::Center ||
-        contentAsFE.HorizontalAlignment() == winrt::HorizontalAlignment::Stretch)
-    {
-        float scrollableWidth = extentWidth * zoomFactor - scrollerVisual.Size().x;
-
-        if (minPosition)
-        {
-            // When the zoomed content is smaller than the viewport, scrollableWidth < 0, minPosX is scrollableWidth / 2 so it is centered at idle.
-            // When the zoomed content is larger than the viewport, scrollableWidth > 0, minPosX is 0.
-            minPosX = std::min(0.0f, scrollableWidth / 2.0f);
-        }
-
-        if (maxPosition)
-        {
-            // When the zoomed content is smaller than the viewport, scrollableWidth < 0, maxPosX is scrollableWidth / 2 so it is centered at idle.
-            // When the zoomed content is larger than the viewport, scrollableWidth > 0, maxPosX is scrollableWidth.
-            maxPosX = scrollableWidth;
-            if (maxPosX < 0.0f)
-            {
-                maxPosX /= 2.0f;
-            }
-        }
-    }
-    else if (contentAsFE.HorizontalAlignment() == winrt::HorizontalAlignment::Right)
-    {
-        float scrollableWidth = extentWidth * zoomFactor - scrollerVisual.Size().x;
-
-        if (minPosition)
-        {
-            // When the zoomed content is smaller than the viewport, scrollableWidth < 0, minPosX is scrollableWidth so it is right-aligned at idle.
-            // When the zoomed content is larger than the viewport, scrollableWidth > 0, minPosX is 0.
-            minPosX = std::min(0.0f, scrollableWidth);
-        }
-
-        if (maxPosition)
-        {
-            // When the zoomed content is smaller than the viewport, scrollableWidth < 0, maxPosX is -scrollableWidth so it is right-aligned at idle.
-            // When the zoomed content is larger than the viewport, scrollableWidth > 0, maxPosX is scrollableWidth.
-            maxPosX = scrollableWidth;
-            if (maxPosX < 0.0f)
-            {
-                maxPosX *= -1.0f;
-            }
-        }
-    }
-
-    if (contentAsFE.VerticalAlignment() == winrt::VerticalAlignment::Center ||
-        contentAsFE.VerticalAlignment() == winrt::VerticalAlignment::Stretch)
-    {
-        float scrollableHeight = extentHeight * zoomFactor - scrollerVisual.Size().y;
-
-        if (minPosition)
-        {
-            // When the zoomed content is smaller than the viewport, scrollableHeight < 0, minPosY is scrollableHeight / 2 so it is centered at idle.
-            // When the zoomed content is larger than the viewport, scrollableHeight > 0, minPosY is 0.
-            minPosY = std::min(0.0f, scrollableHeight / 2.0f);
-        }
-
-        if (maxPosition)
-        {
-            // When the zoomed content is smaller than the viewport, scrollableHeight < 0, maxPosY is scrollableHeight / 2 so it is centered at idle.
-            // When the zoomed content is larger than the viewport, scrollableHeight > 0, maxPosY is scrollableHeight.
-            maxPosY = scrollableHeight;
-            if (maxPosY < 0.0f)
-            {
-                maxPosY /= 2.0f;
-            }
-        }
-    }
-    else if (contentAsFE.VerticalAlignment() == winrt::VerticalAlignment::Bottom)
-    {
-        float scrollableHeight = extentHeight * zoomFactor - scrollerVisual.Size().y;
-
-        if (minPosition)
-        {
-            // When the zoomed content is smaller than the viewport, scrollableHeight < 0, minPosY is scrollableHeight so it is right-aligned at idle.
-            // When the zoomed content is larger than the viewport, scrollableHeight > 0, minPosY is 0.
-            minPosY = std::min(0.0f, scrollableHeight);
-        }
 
-        if (maxPosition)
-        {
-            // When the zoomed content is smaller than the viewport, scrollableHeight < 0, maxPosY is -scrollableHeight so it is right-aligned at idle.
-            // When the zoomed content is larger than the viewport, scrollableHeight > 0, maxPosY is scrollableHeight.
-            maxPosY = scrollableHeight;
-            if (maxPosY < 0.0f)
-            {
-                maxPosY *= -1.0f;
-            }
-        }
-    }
+    ScrollerViewMath::ComputeMinMaxPosition(
+        horizontalAlignment,
+        static_cast<float>(m_unzoomedExtentWidth),
+        scrollerSize.x,
+        zoomFactor,
+        minPosition ? &minPosX : nullptr,
+        maxPosition ? &maxPosX : nullptr);
+    ScrollerViewMath::ComputeMinMaxPosition(
+        verticalAlignment,
+        static_cast<float>(m_unzoomedExtentHeight),
+        scrollerSize.y,
+        zoomFactor,
+        minPosition ? &minPosY : nullptr,
+        maxPosition ? &maxPosY : nullptr);
 
     if (minPosition)
     {
@@ -1413,6 +1345,17 @@ double Scroller::ComputeValueAfterSnapPoints(
     double value,
     std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>> const& snapPointsSet)
 {
+    SnapPointZones<T>& snapPointZones = GetSnapPointZones(&snapPointsSet);
+
+    if (snapPointZones.IsValid())
+    {
+        if (SnapPointWrapper<T>* snapPointWrapper = snapPointZones.FindZone(value))
+        {
+            return snapPointWrapper->Evaluate(static_cast<float>(value));
+        }
+        return value;
+    }
+
     for (std::shared_ptr<SnapPointWrapper<T>> snapPointWrapper : snapPointsSet)
     {
         if (std::get<0>(snapPointWrapper->ActualApplicableZone()) <= value &&
@@ -1520,83 +1463,33 @@ void Scroller::ComputeBringIntoViewTargetOffsets(
     double targetY = transformedRect.Y;
     double targetHeight = transformedRect.Height;
 
-    if (!isnan(requestEventArgs.HorizontalAlignmentRatio()))
-    {
-        // Account for the horizontal alignment ratio
-        MUX_ASSERT(requestEventArgs.HorizontalAlignmentRatio() >= 0.0 && requestEventArgs.HorizontalAlignmentRatio() <= 1.0);
-
-        targetX += (targetWidth - m_viewportWidth / m_zoomFactor) * requestEventArgs.HorizontalAlignmentRatio();
-        targetWidth = m_viewportWidth / m_zoomFactor;
-    }
-
-    if (!isnan(requestEventArgs.VerticalAlignmentRatio()))
-    {
-        // Account for the vertical alignment ratio
-        MUX_ASSERT(requestEventArgs.VerticalAlignmentRatio() >= 0.0 && requestEventArgs.VerticalAlignmentRatio() <= 1.0);
-
-        targetY += (targetHeight - m_viewportHeight / m_zoomFactor) * requestEventArgs.VerticalAlignmentRatio();
-        targetHeight = m_viewportHeight / m_zoomFactor;
-    }
-
-    double targetZoomedHorizontalOffsetTmp = ComputeZoomedOffsetWithMinimalChange(
-        m_zoomedHorizontalOffset,
-        m_zoomedHorizontalOffset + m_viewportWidth,
-        targetX * m_zoomFactor,
-        (targetX + targetWidth) * m_zoomFactor);
-    double targetZoomedVerticalOffsetTmp = ComputeZoomedOffsetWithMinimalChange(
-        m_zoomedVerticalOffset,
-        m_zoomedVerticalOffset + m_viewportHeight,
-        targetY * m_zoomFactor,
-        (targetY + targetHeight) * m_zoomFactor);
+    // Account for the alignment ratios
+    ScrollerViewMath::ApplyAlignmentRatio(requestEventArgs.HorizontalAlignmentRatio(), m_viewportWidth, m_zoomFactor, &targetX, &targetWidth);
+    ScrollerViewMath::ApplyAlignmentRatio(requestEventArgs.VerticalAlignmentRatio(), m_viewportHeight, m_zoomFactor, &targetY, &targetHeight);
 
     const double scrollableWidth = ScrollableWidth();
     const double scrollableHeight = ScrollableHeight();
-
-    targetZoomedHorizontalOffsetTmp = std::clamp(targetZoomedHorizontalOffsetTmp, 0.0, scrollableWidth);
-    targetZoomedVerticalOffsetTmp = std::clamp(targetZoomedVerticalOffsetTmp, 0.0, scrollableHeight);
-
-    const double offsetX = requestEventArgs.HorizontalOffset();
-    const double offsetY = requestEventArgs.VerticalOffset();
     double appliedOffsetXTmp = 0.0;
     double appliedOffsetYTmp = 0.0;
 
-    // If the target offset is within bounds and an offset was provided, apply as much of it as possible while remaining within bounds.
-    if (offsetX != 0.0 && targetZoomedHorizontalOffsetTmp >= 0.0)
-    {
-        if (targetZoomedHorizontalOffsetTmp <= scrollableWidth)
-        {
-            if (offsetX > 0.0)
-            {
-                appliedOffsetXTmp = std::min(targetZoomedHorizontalOffsetTmp, offsetX);
-            }
-            else
-            {
-                appliedOffsetXTmp = -std::min(scrollableWidth - targetZoomedHorizontalOffsetTmp, -offsetX);
-            }
-            targetZoomedHorizontalOffsetTmp -= appliedOffsetXTmp;
-        }
-    }
-
-    if (offsetY != 0.0 && targetZoomedVerticalOffsetTmp >= 0.0)
-    {
-        if (targetZoomedVerticalOffsetTmp <= scrollableHeight)
-        {
-            if (offsetY > 0.0)
-            {
-                appliedOffsetYTmp = std::min(targetZoomedVerticalOffsetTmp, offsetY);
-            }
-            else
-            {
-                appliedOffsetYTmp = -std::min(scrollableHeight - targetZoomedVerticalOffsetTmp, -offsetY);
-            }
-            targetZoomedVerticalOffsetTmp -= appliedOffsetYTmp;
-        }
-    }
-
-    MUX_ASSERT(targetZoomedHorizontalOffsetTmp >= 0.0);
-    MUX_ASSERT(targetZoomedVerticalOffsetTmp >= 0.0);
-    MUX_ASSERT(targetZoomedHorizontalOffsetTmp <= scrollableWidth);
-    MUX_ASSERT(targetZoomedVerticalOffsetTmp <= scrollableHeight);
+    double targetZoomedHorizontalOffsetTmp = ScrollerViewMath::ComputeBringIntoViewTargetOffset(
+        m_zoomedHorizontalOffset,
+        m_viewportWidth,
+        m_zoomFactor,
+        scrollableWidth,
+        targetX,
+        targetWidth,
+        requestEventArgs.HorizontalOffset(),
+        &appliedOffsetXTmp);
+    double targetZoomedVerticalOffsetTmp = ScrollerViewMath::ComputeBringIntoViewTargetOffset(
+        m_zoomedVerticalOffset,
+        m_viewportHeight,
+        m_zoomFactor,
+        scrollableHeight,
+        targetY,
+        targetHeight,
+        requestEventArgs.VerticalOffset(),
+        &appliedOffsetYTmp);
 
     if (snapPointsMode == winrt::SnapPointsMode::Default)
     {
@@ -1856,6 +1749,87 @@ void Scroller::EnsureTransformExpressionAnimations()
     }
 }
 
+// Groups runs of neighboring irregular snap points with contiguous actual applicable zones into composites, each handed to
+// the InteractionTracker as a single inertia modifier. Runs shorter than s_minCompositeSnapPointCount keep one modifier per
+// snap point, while longer runs are split into composites of at most s_maxCompositeSnapPointCount snap points.
+template <typename T>
+void Scroller::UpdateCompositeSnapPoints(
+    std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet)
+{
+    MUX_ASSERT(snapPointsSet);
+
+    std::vector<SnapPointWrapper<T>*> run;
+
+    auto composeRun = [&run]()
+    {
+        const int runSize = static_cast<int>(run.size());
+
+        if (runSize >= s_minCompositeSnapPointCount)
+        {
+            // A trailing single snap point is left out of the composites.
+            for (int first = 0; first < runSize - 1; first += s_maxCompositeSnapPointCount)
+            {
+                const int last = std::min(runSize, first + s_maxCompositeSnapPointCount);
+                auto compositeSnapPointWrapper = std::make_shared<CompositeSnapPointWrapper<T>>(
+                    std::vector<SnapPointWrapper<T>*>(run.begin() + first, run.begin() + last));
+
+                for (int index = first; index < last; index++)
+                {
+                    run[index]->Composite(compositeSnapPointWrapper);
+                }
+            }
+        }
+
+        run.clear();
+    };
+
+    const bool areCompositeSnapPointsEnabled = AreCompositeSnapPointsEnabled();
+
+    for (auto snapPointWrapper : *snapPointsSet)
+    {
+        snapPointWrapper->Composite(nullptr);
+
+        if (!areCompositeSnapPointsEnabled)
+        {
+            continue;
+        }
+
+        if (!CompositeSnapPointWrapper<T>::IsComposable(snapPointWrapper.get()))
+        {
+            composeRun();
+            continue;
+        }
+
+        if (!run.empty() && !CompositeSnapPointWrapper<T>::AreContiguous(run.back(), snapPointWrapper.get()))
+        {
+            composeRun();
+        }
+
+        run.push_back(snapPointWrapper.get());
+    }
+
+    composeRun();
+}
+
+template <typename T>
+int Scroller::GetSnapPointsInertiaModifierCount(
+    std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>> const& snapPointsSet)
+{
+    int modifierCount = 0;
+
+    for (auto snapPointWrapper : snapPointsSet)
+    {
+        std::shared_ptr<CompositeSnapPointWrapper<T>> compositeSnapPointWrapper = snapPointWrapper->Composite();
+
+        if (!compositeSnapPointWrapper || compositeSnapPointWrapper->First() == snapPointWrapper.get())
+        {
+            modifierCount++;
+        }
+    }
+
+    return modifierCount;
+}
+
 template <typename T>
 void Scroller::SetupSnapPoints(
     std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet,
@@ -1895,6 +1869,9 @@ void Scroller::SetupSnapPoints(
     // Update the regular and impulse actual applicable ranges.
     UpdateSnapPointsRanges(snapPointsSet, false /*forImpulseOnly*/);
 
+    // Group runs of irregular snap points into composite inertia modifiers.
+    UpdateCompositeSnapPoints(snapPointsSet);
+
     winrt::Compositor compositor = m_interactionTracker.Compositor();
     winrt::IVector<winrt::InteractionTrackerInertiaModifier> modifiers = winrt::make<Vector<winrt::InteractionTrackerInertiaModifier>>();
 
@@ -1941,11 +1918,25 @@ void Scroller::SetupSnapPoints(
     {
         for (auto snapPointWrapper : *snapPointsSet)
         {
-            winrt::InteractionTrackerInertiaRestingValue modifier = GetInertiaRestingValue(
-                snapPointWrapper,
-                compositor,
-                target,
-                scale);
+            std::shared_ptr<CompositeSnapPointWrapper<T>> compositeSnapPointWrapper = snapPointWrapper->Composite();
+
+            if (compositeSnapPointWrapper && compositeSnapPointWrapper->First() != snapPointWrapper.get())
+            {
+                // This snap point is covered by the composite modifier of its run's first snap point.
+                continue;
+            }
+
+            winrt::InteractionTrackerInertiaRestingValue modifier = compositeSnapPointWrapper ?
+                GetInertiaRestingValue(
+                    compositeSnapPointWrapper,
+                    compositor,
+                    target,
+                    scale) :
+                GetInertiaRestingValue(
+                    snapPointWrapper,
+                    compositor,
+                    target,
+                    scale);
 
             modifiers.Append(modifier);
         }
@@ -2011,6 +2002,11 @@ void Scroller::UpdateSnapPointsRanges(
             nullptr,
             forImpulseOnly);
     }
+
+    if (!forImpulseOnly)
+    {
+        GetSnapPointZones(snapPointsSet).Update(*snapPointsSet);
+    }
 }
 
 template <typename T>
@@ -2044,8 +2040,18 @@ void Scroller::UpdateSnapPointsIgnoredValue(
 
         for (auto snapPointWrapper : *snapPointsSet)
         {
+            std::shared_ptr<CompositeSnapPointWrapper<T>> compositeSnapPointWrapper = snapPointWrapper->Composite();
+
+            if (compositeSnapPointWrapper && compositeSnapPointWrapper->First() != snapPointWrapper.get())
+            {
+                // This snap point is covered by the composite modifier of its run's first snap point.
+                continue;
+            }
+
             auto modifier = winrt::InteractionTrackerInertiaRestingValue::Create(compositor);
-            auto const [conditionExpressionAnimation, restingValueExpressionAnimation] = snapPointWrapper->GetUpdatedExpressionAnimationsForImpulse();
+            auto const [conditionExpressionAnimation, restingValueExpressionAnimation] = compositeSnapPointWrapper ?
+                compositeSnapPointWrapper->GetUpdatedExpressionAnimationsForImpulse() :
+                snapPointWrapper->GetUpdatedExpressionAnimationsForImpulse();
 
             modifier.Condition(conditionExpressionAnimation);
             modifier.RestingValue(restingValueExpressionAnimation);
@@ -2102,13 +2108,26 @@ bool Scroller::UpdateSnapPointsIgnoredValue(
 
     if (snapCount > 1)
     {
-        for (auto snapPointWrapper : *snapPointsSet)
+        SnapPointZones<T>& snapPointZones = GetSnapPointZones(snapPointsSet);
+
+        if (snapPointZones.IsValid())
         {
-            if (snapPointWrapper->SnapsAt(newIgnoredValue))
+            if (SnapPointWrapper<T>* snapPointWrapper = snapPointZones.FindSnappingZone(newIgnoredValue))
             {
                 snapPointWrapper->SetIgnoredValue(newIgnoredValue);
                 ignoredValueUpdated = true;
-                break;
+            }
+        }
+        else
+        {
+            for (auto snapPointWrapper : *snapPointsSet)
+            {
+                if (snapPointWrapper->SnapsAt(newIgnoredValue))
+                {
+                    snapPointWrapper->SetIgnoredValue(newIgnoredValue);
+                    ignoredValueUpdated = true;
+                    break;
+                }
             }
         }
     }
@@ -2131,8 +2150,18 @@ void Scroller::UpdateSnapPointsInertiaFromImpulse(
 
         for (auto snapPointWrapper : *snapPointsSet)
         {
+            std::shared_ptr<CompositeSnapPointWrapper<T>> compositeSnapPointWrapper = snapPointWrapper->Composite();
+
+            if (compositeSnapPointWrapper && compositeSnapPointWrapper->First() != snapPointWrapper.get())
+            {
+                // This snap point is covered by the composite modifier of its run's first snap point.
+                continue;
+            }
+
             auto modifier = winrt::InteractionTrackerInertiaRestingValue::Create(compositor);
-            auto const [conditionExpressionAnimation, restingValueExpressionAnimation] = snapPointWrapper->GetUpdatedExpressionAnimationsForImpulse(isInertiaFromImpulse);
+            auto const [conditionExpressionAnimation, restingValueExpressionAnimation] = compositeSnapPointWrapper ?
+                compositeSnapPointWrapper->GetUpdatedExpressionAnimationsForImpulse(isInertiaFromImpulse) :
+                snapPointWrapper->GetUpdatedExpressionAnimationsForImpulse(isInertiaFromImpulse);
 
             modifier.Condition(conditionExpressionAnimation);
             modifier.RestingValue(restingValueExpressionAnimation);
@@ -3555,38 +3584,6 @@ winrt::InteractionSourceMode Scroller::InteractionSourceModeFromZoomMode(
     return zoomMode == winrt::ZoomMode::Enabled ? winrt::InteractionSourceMode::EnabledWithInertia : winrt::InteractionSourceMode::Disabled;
 }
 
-double Scroller::ComputeZoomedOffsetWithMinimalChange(
-    double viewportStart,
-    double viewportEnd,
-    double childStart,
-    double childEnd)
-{
-    bool above = childStart < viewportStart && childEnd < viewportEnd;
-    bool below = childEnd > viewportEnd && childStart > viewportStart;
-    bool larger = (childEnd - childStart) > (viewportEnd - viewportStart);
-
-    // # CHILD POSITION   CHILD SIZE   SCROLL   REMEDY
-    // 1 Above viewport   <= viewport  Down     Align top edge of content & viewport
-    // 2 Above viewport   >  viewport  Down     Align bottom edge of content & viewport
-    // 3 Below viewport   <= viewport  Up       Align bottom edge of content & viewport
-    // 4 Below viewport   >  viewport  Up       Align top edge of content & viewport
-    // 5 Entirely within viewport      NA       No change
-    // 6 Spanning viewport             NA       No change
-    if ((above && !larger) || (below && larger))
-    {
-        // Cases 1 & 4
-        return childStart;
-    }
-    else if (above || below)
-    {
-        // Cases 2 & 3
-        return childEnd - viewportEnd + viewportStart;
-    }
-
-    // cases 5 & 6
-    return viewportStart;
-}
-
 winrt::Rect Scroller::GetDescendantBounds(
     const winrt::UIElement& content,
     const winrt::UIElement& descendant,
@@ -3640,6 +3637,14 @@ bool Scroller::IsInteractionTrackerPointerWheelRedirectionEnabled()
     return isInteractionTrackerPointerWheelRedirectionEnabled;
 }
 
+// Returns True unless a test hook is set to hand the InteractionTracker one inertia modifier per snap point.
+bool Scroller::AreCompositeSnapPointsEnabled()
+{
+    com_ptr<ScrollerTestHooks> globalTestHooks = ScrollerTestHooks::GetGlobalTestHooks();
+
+    return !globalTestHooks || globalTestHooks->AreCompositeSnapPointsEnabled();
+}
+
 // Returns True on RedStone 2 and later versions, where the ElementCompositionPreview::SetIsTranslationEnabled method is available.
 bool Scroller::IsVisualTranslationPropertyAvailable()
 {
@@ -3788,6 +3793,22 @@ SnapPointWrapper<winrt::ScrollSnapPointBase>* Scroller::GetScrollSnapPointWrappe
     return nullptr;
 }
 
+int Scroller::GetSnapPointsInertiaModifierCount(ScrollerDimension dimension) const
+{
+    switch (dimension)
+    {
+    case ScrollerDimension::HorizontalScroll:
+        return GetSnapPointsInertiaModifierCount(m_sortedConsolidatedHorizontalSnapPoints);
+    case ScrollerDimension::VerticalScroll:
+        return GetSnapPointsInertiaModifierCount(m_sortedConsolidatedVerticalSnapPoints);
+    case ScrollerDimension::ZoomFactor:
+        return GetSnapPointsInertiaModifierCount(m_sortedConsolidatedZoomSnapPoints);
+    default:
+        MUX_ASSERT(false);
+        return 0;
+    }
+}
+
 SnapPointWrapper<winrt::ZoomSnapPointBase>* Scroller::GetZoomSnapPointWrapper(winrt::ZoomSnapPointBase const& zoomSnapPoint)
 {
     for (std::shared_ptr<SnapPointWrapper<winrt::ZoomSnapPointBase>> snapPointWrapper : m_sortedConsolidatedZoomSnapPoints)
@@ -3999,7 +4020,15 @@ void Scroller::OnCompositionTargetRendering(const winrt::IInspectable& /*sender*
                 if (needsProcessing)
                 {
                     // InteractionTracker is ready for the operation's processing.
-                    ProcessDequeuedViewChange(interactionTrackerAsyncOperation);
+                    if (IsViewChangeCoalescingEnabled() && !interactionTrackerAsyncOperation->IsAnimated())
+                    {
+                        // Skip the operations merged into the same InteractionTracker request.
+                        operationsIter = ProcessDequeuedOffsetsChanges(interactionTrackerAsyncOperation, operationsIter);
+                    }
+                    else
+                    {
+                        ProcessDequeuedViewChange(interactionTrackerAsyncOperation);
+                    }
                     if (!interactionTrackerAsyncOperation->IsAnimated())
                     {
                         unhookCompositionTargetRendering = false;
@@ -5068,6 +5097,8 @@ void Scroller::SnapPointsVectorItemInsertedHelper(
     std::shared_ptr<SnapPointWrapper<T>> insertedItem,
     std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet)
 {
+    GetSnapPointZones(snapPointsSet).Invalidate();
+
     if (snapPointsSet->empty())
     {
         snapPointsSet->insert(insertedItem);
@@ -5110,6 +5141,7 @@ void Scroller::RegenerateSnapPointsSet(
 {
     MUX_ASSERT(internalSet);
 
+    GetSnapPointZones(internalSet).Invalidate();
     internalSet->clear();
     for (T snapPoint : userVector)
     {
@@ -5120,6 +5152,62 @@ void Scroller::RegenerateSnapPointsSet(
     }
 }
 
+// Invoked after the snap points of the provided user vector were given a new viewport size. Returns True when
+// regenerating the internal set would produce the same wrappers in the same order, in which case the existing
+// wrappers are kept and only their actual applicable zones are recomputed. That is the case when no snap point
+// was combined with another and the updated snap points are still strictly ordered, without equal neighbors.
+template <typename T>
+bool Scroller::TryReuseSnapPointsSet(
+    winrt::IObservableVector<T> const& userVector,
+    std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* internalSet)
+{
+    MUX_ASSERT(internalSet);
+
+    if (userVector.Size() != internalSet->size())
+    {
+        return false;
+    }
+
+    SnapPointBase* previousSnapPoint = nullptr;
+
+    for (auto const& snapPointWrapper : *internalSet)
+    {
+        SnapPointBase* snapPoint = SnapPointWrapper<T>::GetSnapPointFromWrapper(snapPointWrapper);
+
+        if (previousSnapPoint && (!(*previousSnapPoint < snapPoint) || *previousSnapPoint == snapPoint))
+        {
+            return false;
+        }
+
+        previousSnapPoint = snapPoint;
+    }
+
+    // Like freshly regenerated wrappers, the kept ones start without an ignored value.
+    for (auto const& snapPointWrapper : *internalSet)
+    {
+        snapPointWrapper->ResetIgnoredValue();
+    }
+
+    UpdateSnapPointsRanges(internalSet, false /*forImpulseOnly*/);
+    return true;
+}
+
+SnapPointZones<winrt::ScrollSnapPointBase>& Scroller::GetSnapPointZones(
+    std::set<std::shared_ptr<SnapPointWrapper<winrt::ScrollSnapPointBase>>, SnapPointWrapperComparator<winrt::ScrollSnapPointBase>> const* snapPointsSet)
+{
+    MUX_ASSERT(snapPointsSet == &m_sortedConsolidatedHorizontalSnapPoints || snapPointsSet == &m_sortedConsolidatedVerticalSnapPoints);
+
+    return snapPointsSet == &m_sortedConsolidatedHorizontalSnapPoints ? m_horizontalSnapPointZones : m_verticalSnapPointZones;
+}
+
+SnapPointZones<winrt::ZoomSnapPointBase>& Scroller::GetSnapPointZones(
+    std::set<std::shared_ptr<SnapPointWrapper<winrt::ZoomSnapPointBase>>, SnapPointWrapperComparator<winrt::ZoomSnapPointBase>> const* snapPointsSet)
+{
+    MUX_ASSERT(snapPointsSet == &m_sortedConsolidatedZoomSnapPoints);
+
+    return m_zoomSnapPointZones;
+}
+
 void Scroller::UpdateContent(
     const winrt::UIElement& oldContent,
     const winrt::UIElement& newContent)
@@ -5361,28 +5449,34 @@ void Scroller::UpdateUnzoomedExtentAndViewport(
     if (horizontalViewportChanged && m_horizontalSnapPoints && m_horizontalSnapPointsNeedViewportUpdates)
     {
         // At least one horizontal scroll snap point is not near-aligned and is thus sensitive to the
-        // viewport width. Regenerate and set up all horizontal scroll snap points.
+        // viewport width. Update or regenerate, and set up all horizontal scroll snap points.
         auto horizontalSnapPoints = m_horizontalSnapPoints.try_as<winrt::IObservableVector<winrt::ScrollSnapPointBase>>();
         bool horizontalSnapPointsNeedViewportUpdates = SnapPointsViewportChangedHelper(
             horizontalSnapPoints,
             m_viewportWidth);
         MUX_ASSERT(horizontalSnapPointsNeedViewportUpdates);
 
-        RegenerateSnapPointsSet(horizontalSnapPoints, &m_sortedConsolidatedHorizontalSnapPoints);
+        if (!TryReuseSnapPointsSet(horizontalSnapPoints, &m_sortedConsolidatedHorizontalSnapPoints))
+        {
+            RegenerateSnapPointsSet(horizontalSnapPoints, &m_sortedConsolidatedHorizontalSnapPoints);
+        }
         SetupSnapPoints(&m_sortedConsolidatedHorizontalSnapPoints, ScrollerDimension::HorizontalScroll);
     }
 
     if (verticalViewportChanged && m_verticalSnapPoints && m_verticalSnapPointsNeedViewportUpdates)
     {
         // At least one vertical scroll snap point is not near-aligned and is thus sensitive to the
-        // viewport height. Regenerate and set up all vertical scroll snap points.
+        // viewport height. Update or regenerate, and set up all vertical scroll snap points.
         auto verticalSnapPoints = m_verticalSnapPoints.try_as<winrt::IObservableVector<winrt::ScrollSnapPointBase>>();
         bool verticalSnapPointsNeedViewportUpdates = SnapPointsViewportChangedHelper(
             verticalSnapPoints,
             m_viewportHeight);
         MUX_ASSERT(verticalSnapPointsNeedViewportUpdates);
 
-        RegenerateSnapPointsSet(verticalSnapPoints, &m_sortedConsolidatedVerticalSnapPoints);
+        if (!TryReuseSnapPointsSet(verticalSnapPoints, &m_sortedConsolidatedVerticalSnapPoints))
+        {
+            RegenerateSnapPointsSet(verticalSnapPoints, &m_sortedConsolidatedVerticalSnapPoints);
+        }
         SetupSnapPoints(&m_sortedConsolidatedVerticalSnapPoints, ScrollerDimension::VerticalScroll);
     }
 
@@ -6415,6 +6509,122 @@ void Scroller::ProcessDequeuedViewChange(std::shared_ptr<InteractionTrackerAsync
     interactionTrackerAsyncOperation->SetRequestId(m_latestInteractionTrackerRequest);
 }
 
+// Used when IsViewChangeCoalescingEnabled is True. Merges the non-animated offsets changes that become due
+// in the same tick as the provided operation, starting at nextOperationsIter, into a single InteractionTracker
+// request. The merged operations share that request's id so they complete together, each raising its own
+// ScrollCompleted event. Returns the iterator following the last merged operation.
+std::list<std::shared_ptr<InteractionTrackerAsyncOperation>>::iterator Scroller::ProcessDequeuedOffsetsChanges(
+    std::shared_ptr<InteractionTrackerAsyncOperation> interactionTrackerAsyncOperation,
+    std::list<std::shared_ptr<InteractionTrackerAsyncOperation>>::iterator nextOperationsIter)
+{
+    MUX_ASSERT(IsLoadedAndSetUp());
+    MUX_ASSERT(!interactionTrackerAsyncOperation->IsQueued());
+    MUX_ASSERT(!interactionTrackerAsyncOperation->IsAnimated());
+
+    // Returns the OffsetsChange of a non-animated offsets change operation, or null for any other operation.
+    auto getOffsetsChange = [](const std::shared_ptr<InteractionTrackerAsyncOperation>& operation)
+    {
+        std::shared_ptr<OffsetsChange> offsetsChange{ nullptr };
+
+        if (operation->GetOperationType() == InteractionTrackerAsyncOperationType::TryUpdatePosition ||
+            operation->GetOperationType() == InteractionTrackerAsyncOperationType::TryUpdatePositionBy)
+        {
+            offsetsChange = std::reinterpret_pointer_cast<OffsetsChange>(operation->GetViewChangeBase());
+
+            if (offsetsChange->ViewKind() != ScrollerViewKind::Absolute && offsetsChange->ViewKind() != ScrollerViewKind::RelativeToCurrentView)
+            {
+                offsetsChange = nullptr;
+            }
+        }
+        return offsetsChange;
+    };
+
+    auto isIgnoringSnapPoints = [](const std::shared_ptr<OffsetsChange>& offsetsChange)
+    {
+        winrt::ScrollOptions options = offsetsChange->Options().try_as<winrt::ScrollOptions>();
+
+        return (options ? options.SnapPointsMode() : ScrollOptions::s_defaultSnapPointsMode) == winrt::SnapPointsMode::Ignore;
+    };
+
+    std::shared_ptr<OffsetsChange> mergedOffsetsChange = getOffsetsChange(interactionTrackerAsyncOperation);
+
+    if (!mergedOffsetsChange)
+    {
+        ProcessDequeuedViewChange(interactionTrackerAsyncOperation);
+        return nextOperationsIter;
+    }
+
+    std::vector<std::shared_ptr<InteractionTrackerAsyncOperation>> mergedOperations{ interactionTrackerAsyncOperation };
+    auto operationsIter = nextOperationsIter;
+
+    for (; operationsIter != m_interactionTrackerAsyncOperations.end(); operationsIter++)
+    {
+        const auto& nextOperation = *operationsIter;
+
+        if (nextOperation->IsDelayed() || nextOperation->GetTicksCountdown() != 1)
+        {
+            // Operation is not due in this tick.
+            break;
+        }
+
+        std::shared_ptr<OffsetsChange> nextOffsetsChange = getOffsetsChange(nextOperation);
+
+        if (!nextOffsetsChange)
+        {
+            break;
+        }
+
+        if (nextOffsetsChange->ViewKind() == ScrollerViewKind::Absolute || !isIgnoringSnapPoints(nextOffsetsChange))
+        {
+            // The target of an absolute change, or of a relative change applying snap points, is evaluated against the
+            // current view and overrides the prior changes launched in this tick.
+            mergedOffsetsChange = nextOffsetsChange;
+        }
+        else if (isIgnoringSnapPoints(mergedOffsetsChange))
+        {
+            // Deltas ignoring snap points accumulate. The merged target is only clamped once by the InteractionTracker.
+            mergedOffsetsChange = std::make_shared<OffsetsChange>(
+                mergedOffsetsChange->ZoomedHorizontalOffset() + nextOffsetsChange->ZoomedHorizontalOffset(),
+                mergedOffsetsChange->ZoomedVerticalOffset() + nextOffsetsChange->ZoomedVerticalOffset(),
+                mergedOffsetsChange->ViewKind(),
+                mergedOffsetsChange->Options());
+        }
+        else
+        {
+            // A delta cannot be applied on top of a target that still needs to be snapped.
+            break;
+        }
+
+        bool needsProcessing = false;
+
+        nextOperation->TickQueuedOperation(&needsProcessing);
+        MUX_ASSERT(needsProcessing);
+
+        mergedOperations.push_back(nextOperation);
+    }
+
+    if (mergedOperations.size() == 1)
+    {
+        ProcessDequeuedViewChange(interactionTrackerAsyncOperation);
+        return nextOperationsIter;
+    }
+
+    SCROLLER_TRACE_VERBOSE(*this, TRACE_MSG_METH_INT, METH_NAME, this, static_cast<int>(mergedOperations.size()));
+
+    ProcessOffsetsChange(
+        mergedOperations.back()->GetOperationTrigger() /*operationTrigger*/,
+        mergedOffsetsChange,
+        mergedOperations.back()->GetViewChangeId() /*offsetsChangeId*/,
+        true /*isForAsyncOperation*/);
+
+    for (auto& mergedOperation : mergedOperations)
+    {
+        mergedOperation->SetRequestId(m_latestInteractionTrackerRequest);
+    }
+
+    return operationsIter;
+}
+
 // Launches an InteractionTracker request to change the offsets.
 void Scroller::ProcessOffsetsChange(
     InteractionTrackerAsyncOperationTrigger operationTrigger,
@@ -7195,6 +7405,26 @@ winrt::InteractionTrackerInertiaRestingValue Scroller::GetInertiaRestingValue(
     return modifier;
 }
 
+template <typename T>
+winrt::InteractionTrackerInertiaRestingValue Scroller::GetInertiaRestingValue(
+    std::shared_ptr<CompositeSnapPointWrapper<T>> compositeSnapPointWrapper,
+    winrt::Compositor const& compositor,
+    winrt::hstring const& target,
+    winrt::hstring const& scale)
+{
+    bool isInertiaFromImpulse = IsInertiaFromImpulse();
+    winrt::InteractionTrackerInertiaRestingValue modifier = winrt::InteractionTrackerInertiaRestingValue::Create(compositor);
+    winrt::ExpressionAnimation conditionExpressionAnimation = compositeSnapPointWrapper->CreateConditionalExpression(
+        m_interactionTracker, target, scale, isInertiaFromImpulse, m_compositeSnapPointExpressions);
+    winrt::ExpressionAnimation restingPointExpressionAnimation = compositeSnapPointWrapper->CreateRestingPointExpression(
+        m_interactionTracker, target, scale, isInertiaFromImpulse, m_compositeSnapPointExpressions);
+
+    modifier.Condition(conditionExpressionAnimation);
+    modifier.RestingValue(restingPointExpressionAnimation);
+
+    return modifier;
+}
+
 // Relies on InteractionTracker.IsInertiaFromImpulse starting with RS5,
 // returns the replacement field m_isInertiaFromImpulse otherwise.
 bool Scroller::IsInertiaFromImpulse() const
@@ -12,6 +12,8 @@
 #include "ScrollerBringingIntoViewEventArgs.h"
 #include "ScrollerAnchorRequestedEventArgs.h"
 #include "SnapPointWrapper.h"
+#include "AnchorCandidateIndex.h"
+#include "CompositeSnapPointWrapper.h"
 #include "ScrollerTrace.h"
 #include "ViewChange.h"
 #include "OffsetsChange.h"
@@ -59,6 +61,7 @@ public:
     static constexpr winrt::ChainingMode s_defaultZoomChainingMode{ winrt::ChainingMode::Auto };
     static constexpr winrt::ZoomMode s_defaultZoomMode{ winrt::ZoomMode::Disabled };
     static constexpr winrt::InputKind s_defaultIgnoredInputKind{ winrt::InputKind::None };
+    static constexpr bool s_defaultIsViewChangeCoalescingEnabled{ false };
     static constexpr winrt::ContentOrientation s_defaultContentOrientation{ winrt::ContentOrientation::None };
     static constexpr bool s_defaultAnchorAtExtent{ true };
     static constexpr double s_defaultMinZoomFactor{ 0.1 };
@@ -244,6 +247,9 @@ public:
     SnapPointWrapper<winrt::ScrollSnapPointBase>* GetScrollSnapPointWrapper(ScrollerDimension dimension, winrt::ScrollSnapPointBase const& scrollSnapPoint);
     SnapPointWrapper<winrt::ZoomSnapPointBase>* GetZoomSnapPointWrapper(winrt::ZoomSnapPointBase const& zoomSnapPoint);
 
+    // Number of inertia modifiers handed to the InteractionTracker for the snap points of a dimension.
+    int GetSnapPointsInertiaModifierCount(ScrollerDimension dimension) const;
+
     // Invoked when a dependency property of this Scroller has changed.
     void OnPropertyChanged(
         const winrt::DependencyPropertyChangedEventArgs& args);
@@ -321,6 +327,10 @@ private:
         std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet,
         ScrollerDimension dimension,
         bool isInertiaFromImpulse);
+    template <typename T> void UpdateCompositeSnapPoints(
+        std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet);
+    template <typename T> static int GetSnapPointsInertiaModifierCount(
+        std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>> const& snapPointsSet);
     void SetupInteractionTrackerBoundaries();
     void SetupInteractionTrackerZoomFactorBoundaries(
         double minZoomFactor, double maxZoomFactor);
@@ -449,6 +459,9 @@ private:
         float maxZoomFactor);
     void ProcessDequeuedViewChange(
         std::shared_ptr<InteractionTrackerAsyncOperation> interactionTrackerAsyncOperation);
+    std::list<std::shared_ptr<InteractionTrackerAsyncOperation>>::iterator ProcessDequeuedOffsetsChanges(
+        std::shared_ptr<InteractionTrackerAsyncOperation> interactionTrackerAsyncOperation,
+        std::list<std::shared_ptr<InteractionTrackerAsyncOperation>>::iterator nextOperationsIter);
     void ProcessOffsetsChange(
         InteractionTrackerAsyncOperationTrigger operationTrigger,
         std::shared_ptr<OffsetsChange> offsetsChange,
@@ -503,6 +516,11 @@ private:
         winrt::Compositor const& compositor,
         winrt::hstring const& target,
         winrt::hstring const& scale) const;
+    template <typename T> winrt::InteractionTrackerInertiaRestingValue GetInertiaRestingValue(
+        std::shared_ptr<CompositeSnapPointWrapper<T>> compositeSnapPointWrapper,
+        winrt::Compositor const& compositor,
+        winrt::hstring const& target,
+        winrt::hstring const& scale);
 
 #ifdef USE_SCROLLMODE_AUTO
     winrt::ScrollMode GetComputedScrollMode(ScrollerDimension dimension, bool ignoreZoomMode = false);
@@ -676,6 +694,13 @@ private:
     template <typename T> void RegenerateSnapPointsSet(
         winrt::IObservableVector<T> const& userVector,
         std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* internalSet);
+    template <typename T> bool TryReuseSnapPointsSet(
+        winrt::IObservableVector<T> const& userVector,
+        std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* internalSet);
+    SnapPointZones<winrt::ScrollSnapPointBase>& GetSnapPointZones(
+        std::set<std::shared_ptr<SnapPointWrapper<winrt::ScrollSnapPointBase>>, SnapPointWrapperComparator<winrt::ScrollSnapPointBase>> const* snapPointsSet);
+    SnapPointZones<winrt::ZoomSnapPointBase>& GetSnapPointZones(
+        std::set<std::shared_ptr<SnapPointWrapper<winrt::ZoomSnapPointBase>>, SnapPointWrapperComparator<winrt::ZoomSnapPointBase>> const* snapPointsSet);
 
 #pragma region IRepeaterScrollingSurface Helpers
     void RaiseConfigurationChanged();
@@ -708,6 +733,11 @@ private:
     void ClearAnchorCandidates();
     void ResetAnchorElement();
     void EnsureAnchorElementSelection();
+    void EnsureAnchorCandidateIndex(
+        const winrt::UIElement& content,
+        bool isVertical);
+    void UpdateAnchorCandidateBounds(
+        const winrt::UIElement& content);
 
     void ProcessAnchorCandidate(
         const winrt::UIElement& anchorCandidate,
@@ -719,6 +749,11 @@ private:
         _Inout_ winrt::UIElement* bestAnchorCandidate,
         _Inout_ winrt::Rect* bestAnchorCandidateBounds) const;
 
+    static double ComputeAnchorCandidateDistance(
+        const winrt::Rect& anchorCandidateBounds,
+        double viewportAnchorPointHorizontalOffset,
+        double viewportAnchorPointVerticalOffset);
+
     static winrt::Rect GetDescendantBounds(
         const winrt::UIElement& content,
         const winrt::UIElement& descendant);
@@ -743,18 +778,13 @@ private:
     static winrt::InteractionSourceMode InteractionSourceModeFromZoomMode(
         const winrt::ZoomMode& zoomMode);
 
-    static double ComputeZoomedOffsetWithMinimalChange(
-        double viewportStart,
-        double viewportEnd,
-        double childStart,
-        double childEnd);
-
     static winrt::Rect GetDescendantBounds(
         const winrt::UIElement& content,
         const winrt::UIElement& descendant,
         const winrt::Rect& descendantRect);
 
     static bool IsInteractionTrackerPointerWheelRedirectionEnabled();
+    static bool AreCompositeSnapPointsEnabled();
     static bool IsVisualTranslationPropertyAvailable();
     static wstring_view GetVisualTargetedPropertyName(ScrollerDimension dimension);
 
@@ -802,6 +832,8 @@ private:
     tracker_ref<winrt::UIElement> m_anchorElement{ this };
     tracker_ref<winrt::ScrollerAnchorRequestedEventArgs> m_anchorRequestedEventArgs{ this };
     std::vector<tracker_ref<winrt::UIElement>> m_anchorCandidates;
+    // Bounds of the m_anchorCandidates elements, only recomputed for the candidates whose layout changed.
+    AnchorCandidateIndex m_anchorCandidateIndex{};
     std::list<std::shared_ptr<InteractionTrackerAsyncOperation>> m_interactionTrackerAsyncOperations;
     winrt::Rect m_anchorElementBounds{};
     winrt::InteractionState m_state{ winrt::InteractionState::Idle };
@@ -875,6 +907,18 @@ private:
     std::set<std::shared_ptr<SnapPointWrapper<winrt::ScrollSnapPointBase>>, SnapPointWrapperComparator<winrt::ScrollSnapPointBase>> m_sortedConsolidatedHorizontalSnapPoints{};
     std::set<std::shared_ptr<SnapPointWrapper<winrt::ScrollSnapPointBase>>, SnapPointWrapperComparator<winrt::ScrollSnapPointBase>> m_sortedConsolidatedVerticalSnapPoints{};
     std::set<std::shared_ptr<SnapPointWrapper<winrt::ZoomSnapPointBase>>, SnapPointWrapperComparator<winrt::ZoomSnapPointBase>> m_sortedConsolidatedZoomSnapPoints{};
+    // Binary-searchable copies of the actual applicable zones of the three sets above.
+    SnapPointZones<winrt::ScrollSnapPointBase> m_horizontalSnapPointZones{};
+    SnapPointZones<winrt::ScrollSnapPointBase> m_verticalSnapPointZones{};
+    SnapPointZones<winrt::ZoomSnapPointBase> m_zoomSnapPointZones{};
+
+    // Expression strings generated for composite snap points, shared by the three dimensions.
+    CompositeSnapPointExpressionCache m_compositeSnapPointExpressions{};
+
+    // Minimum number of neighboring irregular snap points grouped into composite inertia modifiers.
+    static constexpr int s_minCompositeSnapPointCount{ 8 };
+    // Maximum number of irregular snap points in a composite inertia modifier. Bounds the composite expressions' size.
+    static constexpr int s_maxCompositeSnapPointCount{ 32 };
 
     // Maximum difference for offsets to be considered equal. Used for pointer wheel scrolling.
     static constexpr float s_offsetEqualityEpsilon{ 0.00001f };
@@ -284,6 +284,7 @@ void Scroller::ClearAnchorCandidates()
     SCROLLER_TRACE_VERBOSE(*this, TRACE_MSG_METH, METH_NAME, this);
 
     m_anchorCandidates.clear();
+    m_anchorCandidateIndex.Clear();
     m_isAnchorElementDirty = true;
 }
 
@@ -388,20 +389,37 @@ void Scroller::EnsureAnchorElementSelection()
     }
     else
     {
-        for (tracker_ref<winrt::UIElement> anchorCandidateTracker : m_anchorCandidates)
+        // The registered candidates are indexed along the anchoring axis so that only the ones overlapping the
+        // viewport are evaluated. Ties are resolved in favor of the last registered candidate, like in the loop above.
+        const bool isVertical = !isnan(viewportAnchorPointVerticalOffset) &&
+            (isnan(viewportAnchorPointHorizontalOffset) || m_contentOrientation != winrt::ContentOrientation::Horizontal);
+        int bestAnchorCandidateIndex = -1;
+
+        EnsureAnchorCandidateIndex(content, isVertical);
+
+        m_anchorCandidateIndex.ForEachOverlapping(
+            viewportAnchorBounds,
+            [&](int anchorCandidateIndex, const winrt::Rect& anchorCandidateBounds)
         {
-            const winrt::UIElement anchorCandidate = anchorCandidateTracker.get();
+            if (!SharedHelpers::DoRectsIntersect(viewportAnchorBounds, anchorCandidateBounds))
+            {
+                return;
+            }
 
-            ProcessAnchorCandidate(
-                anchorCandidate,
-                content,
-                viewportAnchorBounds,
+            const double anchorCandidateDistance = ComputeAnchorCandidateDistance(
+                anchorCandidateBounds,
                 viewportAnchorPointHorizontalOffset,
-                viewportAnchorPointVerticalOffset,
-                &bestAnchorCandidateDistance,
-                &bestAnchorCandidate,
-                &bestAnchorCandidateBounds);
-        }
+                viewportAnchorPointVerticalOffset);
+
+            if (anchorCandidateDistance < bestAnchorCandidateDistance ||
+                (anchorCandidateDistance == bestAnchorCandidateDistance && anchorCandidateIndex > bestAnchorCandidateIndex))
+            {
+                bestAnchorCandidate = m_anchorCandidates[anchorCandidateIndex].get();
+                bestAnchorCandidateBounds = anchorCandidateBounds;
+                bestAnchorCandidateDistance = anchorCandidateDistance;
+                bestAnchorCandidateIndex = anchorCandidateIndex;
+            }
+        });
     }
 
     if (bestAnchorCandidate)
@@ -418,6 +436,107 @@ void Scroller::EnsureAnchorElementSelection()
     }
 }
 
+// Brings the bounds of the registered anchor candidates up to date when an arrange pass or a registration
+// happened since the last check, and sorts them along the provided axis.
+void Scroller::EnsureAnchorCandidateIndex(
+    const winrt::UIElement& content,
+    bool isVertical)
+{
+    if (!m_anchorCandidateIndex.AreLayoutsChecked())
+    {
+        UpdateAnchorCandidateBounds(content);
+    }
+
+    m_anchorCandidateIndex.EnsureSorted(isVertical);
+}
+
+// Recomputes the bounds of the valid anchor candidates whose layout slot, margin, size or parent position changed.
+// The parents are only transformed once each, so a candidate that did not move costs a few property reads instead of
+// an ancestor walk and a TransformToVisual call. A RenderTransform set on a candidate itself is only picked up when
+// one of these also changes.
+void Scroller::UpdateAnchorCandidateBounds(
+    const winrt::UIElement& content)
+{
+    struct ParentInfo
+    {
+        bool isInContent;
+        winrt::Rect bounds;
+    };
+
+    std::unordered_map<const void*, ParentInfo> parentInfos;
+    int updatedCount = 0;
+
+    for (size_t anchorCandidateIndex = 0; anchorCandidateIndex < m_anchorCandidates.size(); anchorCandidateIndex++)
+    {
+        const winrt::UIElement anchorCandidate = m_anchorCandidates[anchorCandidateIndex].get();
+
+        if (anchorCandidate.Visibility() != winrt::Visibility::Visible)
+        {
+            m_anchorCandidateIndex.SetInvalid(anchorCandidateIndex);
+            continue;
+        }
+
+        if (anchorCandidate == content)
+        {
+            m_anchorCandidateIndex.SetBounds(anchorCandidateIndex, nullptr /*layout*/, GetDescendantBounds(content, anchorCandidate));
+            updatedCount++;
+            continue;
+        }
+
+        const winrt::UIElement parent = winrt::VisualTreeHelper::GetParent(anchorCandidate).try_as<winrt::UIElement>();
+
+        if (!parent)
+        {
+            m_anchorCandidateIndex.SetInvalid(anchorCandidateIndex);
+            continue;
+        }
+
+        const void* parentIdentity = winrt::get_abi(parent);
+        auto parentInfo = parentInfos.find(parentIdentity);
+
+        if (parentInfo == parentInfos.end())
+        {
+            const bool isInContent = parent == content || SharedHelpers::IsAncestor(parent, content);
+
+            parentInfo = parentInfos.emplace(
+                parentIdentity,
+                ParentInfo{ isInContent, isInContent ? parent.TransformToVisual(content).TransformBounds(winrt::Rect{ 0.0f, 0.0f, 1.0f, 1.0f }) : winrt::Rect{} }).first;
+        }
+
+        if (!parentInfo->second.isInContent)
+        {
+            m_anchorCandidateIndex.SetInvalid(anchorCandidateIndex);
+            continue;
+        }
+
+        if (const winrt::FrameworkElement anchorCandidateAsFE = anchorCandidate.try_as<winrt::FrameworkElement>())
+        {
+            const AnchorCandidateLayout layout{
+                parentIdentity,
+                parentInfo->second.bounds,
+                winrt::LayoutInformation::GetLayoutSlot(anchorCandidateAsFE),
+                anchorCandidateAsFE.Margin(),
+                static_cast<float>(anchorCandidateAsFE.ActualWidth()),
+                static_cast<float>(anchorCandidateAsFE.ActualHeight()) };
+
+            if (!m_anchorCandidateIndex.HasLayout(anchorCandidateIndex, layout))
+            {
+                m_anchorCandidateIndex.SetBounds(anchorCandidateIndex, &layout, GetDescendantBounds(content, anchorCandidate));
+                updatedCount++;
+            }
+        }
+        else
+        {
+            m_anchorCandidateIndex.SetBounds(anchorCandidateIndex, nullptr /*layout*/, GetDescendantBounds(content, anchorCandidate));
+            updatedCount++;
+        }
+    }
+
+    m_anchorCandidateIndex.MarkLayoutsChecked();
+
+    SCROLLER_TRACE_VERBOSE(*this, TRACE_MSG_METH_INT, METH_NAME, this, updatedCount);
+}
+
 // Checks if the provided anchor candidate is better than the current best, based on its distance to the viewport anchor point,
 // and potentially updates the best candidate and its bounds.
 void Scroller::ProcessAnchorCandidate(
@@ -447,27 +566,44 @@ void Scroller::ProcessAnchorCandidate(
         return;
     }
 
-    // Using the distances from the viewport anchor point to the four corners of the anchor candidate.
+    const double anchorCandidateDistance = ComputeAnchorCandidateDistance(
+        anchorCandidateBounds,
+        viewportAnchorPointHorizontalOffset,
+        viewportAnchorPointVerticalOffset);
+
+    if (anchorCandidateDistance <= *bestAnchorCandidateDistance)
+    {
+        *bestAnchorCandidate = anchorCandidate;
+        *bestAnchorCandidateBounds = anchorCandidateBounds;
+        *bestAnchorCandidateDistance = anchorCandidateDistance;
+    }
+}
+
+// Sums the squared distances from the viewport anchor point to the four corners of the anchor candidate.
+double Scroller::ComputeAnchorCandidateDistance(
+    const winrt::Rect& anchorCandidateBounds,
+    double viewportAnchorPointHorizontalOffset,
+    double viewportAnchorPointVerticalOffset)
+{
     double anchorCandidateDistance{ 0.0 };
 
     if (!isnan(viewportAnchorPointHorizontalOffset))
     {
-        anchorCandidateDistance += std::pow(viewportAnchorPointHorizontalOffset - anchorCandidateBounds.X, 2);
-        anchorCandidateDistance += std::pow(viewportAnchorPointHorizontalOffset - (anchorCandidateBounds.X + anchorCandidateBounds.Width), 2);
+        const double nearDistance = viewportAnchorPointHorizontalOffset - anchorCandidateBounds.X;
+        const double farDistance = nearDistance - anchorCandidateBounds.Width;
+
+        anchorCandidateDistance += nearDistance * nearDistance + farDistance * farDistance;
     }
 
     if (!isnan(viewportAnchorPointVerticalOffset))
     {
-        anchorCandidateDistance += std::pow(viewportAnchorPointVerticalOffset - anchorCandidateBounds.Y, 2);
-        anchorCandidateDistance += std::pow(viewportAnchorPointVerticalOffset - (anchorCandidateBounds.Y + anchorCandidateBounds.Height), 2);
-    }
+        const double nearDistance = viewportAnchorPointVerticalOffset - anchorCandidateBounds.Y;
+        const double farDistance = nearDistance - anchorCandidateBounds.Height;
 
-    if (anchorCandidateDistance <= *bestAnchorCandidateDistance)
-    {
-        *bestAnchorCandidate = anchorCandidate;
-        *bestAnchorCandidateBounds = anchorCandidateBounds;
-        *bestAnchorCandidateDistance = anchorCandidateDistance;
+        anchorCandidateDistance += nearDistance * nearDistance + farDistance * farDistance;
     }
+
+    return anchorCandidateDistance;
 }
 
 // Returns the bounds of a Scroller.Content descendant in respect to that content.
@@ -545,6 +545,11 @@ int ScrollSnapPoint::SnapCount() const
     return 1;
 }
 
+double ScrollSnapPoint::IrregularValue() const
+{
+    return ActualValue();
+}
+
 double ScrollSnapPoint::Evaluate(
     std::tuple<double, double> actualApplicableZone,
     double value) const
@@ -1043,6 +1048,11 @@ int RepeatedScrollSnapPoint::SnapCount() const
     return static_cast<int>((m_end - m_start) / m_interval);
 }
 
+double RepeatedScrollSnapPoint::IrregularValue() const
+{
+    return NAN;
+}
+
 double RepeatedScrollSnapPoint::Evaluate(
     std::tuple<double, double> actualApplicableZone,
     double value) const
@@ -1436,6 +1446,11 @@ int ZoomSnapPoint::SnapCount() const
     return 1;
 }
 
+double ZoomSnapPoint::IrregularValue() const
+{
+    return m_value;
+}
+
 double ZoomSnapPoint::Evaluate(
     std::tuple<double, double> actualApplicableZone,
     double value) const
@@ -1904,6 +1919,11 @@ int RepeatedZoomSnapPoint::SnapCount() const
     return static_cast<int>((m_end - m_start) / m_interval);
 }
 
+double RepeatedZoomSnapPoint::IrregularValue() const
+{
+    return NAN;
+}
+
 double RepeatedZoomSnapPoint::Evaluate(
     std::tuple<double, double> actualApplicableZone,
     double value) const
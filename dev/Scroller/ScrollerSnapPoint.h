@@ -78,6 +78,8 @@ public:
         int& combinationCount,
         winrt::SnapPointBase const& snapPoint) const = 0;
     virtual int SnapCount() const = 0;
+    // Returns the value an irregular snap point rests at, or NaN for a repeated snap point.
+    virtual double IrregularValue() const = 0;
     virtual double Evaluate(std::tuple<double, double> actualApplicableZone, double value) const = 0;
 
     // Returns True when this snap point is sensitive to the viewport size and is interested in future updates.
@@ -102,14 +104,13 @@ public:
         winrt::ExpressionAnimation const& expressionAnimation,
         wstring_view const& scalarName,
         float scalarValue) const;
+    winrt::hstring GetTargetExpression(winrt::hstring const& target) const;
+    winrt::hstring GetIsInertiaFromImpulseExpression(winrt::hstring const& target) const;
 
 protected:
     // Needed as work around for Modern Idl inheritance bug
     SnapPointBase();
 
-    winrt::hstring GetTargetExpression(winrt::hstring const& target) const;
-    winrt::hstring GetIsInertiaFromImpulseExpression(winrt::hstring const& target) const;
-
     double m_specifiedApplicableRange{ INFINITY };
 #ifdef ApplicableRangeType
     // Only mandatory snap points are supported at this point.
@@ -214,6 +215,7 @@ public:
         int& combinationCount,
         winrt::SnapPointBase const& snapPoint) const;
     int SnapCount() const;
+    double IrregularValue() const;
     double Evaluate(
         std::tuple<double, double> actualApplicableZone,
         double value) const;
@@ -303,6 +305,7 @@ public:
         int& combinationCount,
         winrt::SnapPointBase const& snapPoint) const;
     int SnapCount() const;
+    double IrregularValue() const;
     double Evaluate(
         std::tuple<double, double> actualApplicableZone,
         double value) const;
@@ -407,6 +410,7 @@ public:
         int& combinationCount,
         winrt::SnapPointBase const& snapPoint) const;
     int SnapCount() const;
+    double IrregularValue() const;
     double Evaluate(
         std::tuple<double, double> actualApplicableZone,
         double value) const;
@@ -493,6 +497,7 @@ public:
         int& combinationCount,
         winrt::SnapPointBase const& snapPoint) const;
     int SnapCount() const;
+    double IrregularValue() const;
     double Evaluate(
         std::tuple<double, double> actualApplicableZone,
         double value) const;
@@ -79,6 +79,18 @@ void ScrollerTestHooks::IsInteractionTrackerPointerWheelRedirectionEnabled(bool
     hooks->m_isInteractionTrackerPointerWheelRedirectionEnabled = isInteractionTrackerPointerWheelRedirectionEnabled;
 }
 
+bool ScrollerTestHooks::AreCompositeSnapPointsEnabled()
+{
+    auto hooks = EnsureGlobalTestHooks();
+    return hooks->m_areCompositeSnapPointsEnabled;
+}
+
+void ScrollerTestHooks::AreCompositeSnapPointsEnabled(bool areCompositeSnapPointsEnabled)
+{
+    auto hooks = EnsureGlobalTestHooks();
+    hooks->m_areCompositeSnapPointsEnabled = areCompositeSnapPointsEnabled;
+}
+
 int ScrollerTestHooks::MouseWheelDeltaForVelocityUnit()
 {
     auto hooks = EnsureGlobalTestHooks();
@@ -453,6 +465,42 @@ int ScrollerTestHooks::GetZoomSnapPointCombinationCount(
     }
 }
 
+int ScrollerTestHooks::GetHorizontalSnapPointsInertiaModifierCount(const winrt::Scroller& scroller)
+{
+    if (scroller)
+    {
+        return winrt::get_self<Scroller>(scroller)->GetSnapPointsInertiaModifierCount(ScrollerDimension::HorizontalScroll);
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+int ScrollerTestHooks::GetVerticalSnapPointsInertiaModifierCount(const winrt::Scroller& scroller)
+{
+    if (scroller)
+    {
+        return winrt::get_self<Scroller>(scroller)->GetSnapPointsInertiaModifierCount(ScrollerDimension::VerticalScroll);
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+int ScrollerTestHooks::GetZoomSnapPointsInertiaModifierCount(const winrt::Scroller& scroller)
+{
+    if (scroller)
+    {
+        return winrt::get_self<Scroller>(scroller)->GetSnapPointsInertiaModifierCount(ScrollerDimension::ZoomFactor);
+    }
+    else
+    {
+        return 0;
+    }
+}
+
 winrt::Color ScrollerTestHooks::GetSnapPointVisualizationColor(const winrt::SnapPointBase& snapPoint)
 {
 
@@ -31,6 +31,8 @@ public:
     static void AreExpressionAnimationStatusNotificationsRaised(bool areExpressionAnimationStatusNotificationsRaised);
     static bool IsInteractionTrackerPointerWheelRedirectionEnabled();
     static void IsInteractionTrackerPointerWheelRedirectionEnabled(bool isInteractionTrackerPointerWheelRedirectionEnabled);
+    static bool AreCompositeSnapPointsEnabled();
+    static void AreCompositeSnapPointsEnabled(bool areCompositeSnapPointsEnabled);
     static int MouseWheelDeltaForVelocityUnit();
     static void MouseWheelDeltaForVelocityUnit(int mouseWheelDeltaForVelocityUnit);
     static float MouseWheelInertiaDecayRate();
@@ -87,6 +89,9 @@ public:
     static int GetZoomSnapPointCombinationCount(
         const winrt::Scroller& scroller,
         const winrt::ZoomSnapPointBase& zoomSnapPoint);
+    static int GetHorizontalSnapPointsInertiaModifierCount(const winrt::Scroller& scroller);
+    static int GetVerticalSnapPointsInertiaModifierCount(const winrt::Scroller& scroller);
+    static int GetZoomSnapPointsInertiaModifierCount(const winrt::Scroller& scroller);
     static winrt::Color GetSnapPointVisualizationColor(const winrt::SnapPointBase& snapPoint);
     static void SetSnapPointVisualizationColor(const winrt::SnapPointBase& snapPoint, const winrt::Color& color);
 
@@ -103,6 +108,7 @@ private:
     bool m_areInteractionSourcesNotificationsRaised{ false };
     bool m_areExpressionAnimationStatusNotificationsRaised{ false };
     bool m_isInteractionTrackerPointerWheelRedirectionEnabled{ true };
+    bool m_areCompositeSnapPointsEnabled{ true };
     int m_offsetsChangeMsPerUnit{ 0 };
     int m_offsetsChangeMinMs{ 0 };
     int m_offsetsChangeMaxMs{ 0 };
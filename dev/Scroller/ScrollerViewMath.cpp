@@ -0,0 +1,155 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include "ScrollerViewMath.h"
+
+namespace ScrollerViewMath
+{
+
+void ComputeMinMaxPosition(
+    ContentAlignment alignment,
+    float unzoomedExtent,
+    float viewport,
+    float zoomFactor,
+    float* minPosition,
+    float* maxPosition)
+{
+    float minPos = 0.0f;
+    float maxPos = 0.0f;
+
+    if (alignment == ContentAlignment::Center)
+    {
+        const float scrollable = unzoomedExtent * zoomFactor - viewport;
+
+        // When the zoomed content is smaller than the viewport, scrollable < 0, minPos is scrollable / 2 so it is centered at idle.
+        // When the zoomed content is larger than the viewport, scrollable > 0, minPos is 0.
+        minPos = std::min(0.0f, scrollable / 2.0f);
+
+        // When the zoomed content is smaller than the viewport, scrollable < 0, maxPos is scrollable / 2 so it is centered at idle.
+        // When the zoomed content is larger than the viewport, scrollable > 0, maxPos is scrollable.
+        maxPos = scrollable;
+        if (maxPos < 0.0f)
+        {
+            maxPos /= 2.0f;
+        }
+    }
+    else if (alignment == ContentAlignment::End)
+    {
+        const float scrollable = unzoomedExtent * zoomFactor - viewport;
+
+        // When the zoomed content is smaller than the viewport, scrollable < 0, minPos is scrollable so it is end-aligned at idle.
+        // When the zoomed content is larger than the viewport, scrollable > 0, minPos is 0.
+        minPos = std::min(0.0f, scrollable);
+
+        // When the zoomed content is smaller than the viewport, scrollable < 0, maxPos is -scrollable so it is end-aligned at idle.
+        // When the zoomed content is larger than the viewport, scrollable > 0, maxPos is scrollable.
+        maxPos = scrollable;
+        if (maxPos < 0.0f)
+        {
+            maxPos *= -1.0f;
+        }
+    }
+
+    if (minPosition)
+    {
+        *minPosition = minPos;
+    }
+
+    if (maxPosition)
+    {
+        *maxPosition = maxPos;
+    }
+}
+
+double ComputeZoomedOffsetWithMinimalChange(
+    double viewportStart,
+    double viewportEnd,
+    double childStart,
+    double childEnd)
+{
+    bool above = childStart < viewportStart && childEnd < viewportEnd;
+    bool below = childEnd > viewportEnd && childStart > viewportStart;
+    bool larger = (childEnd - childStart) > (viewportEnd - viewportStart);
+
+    // # CHILD POSITION   CHILD SIZE   SCROLL   REMEDY
+    // 1 Above viewport   <= viewport  Down     Align top edge of content & viewport
+    // 2 Above viewport   >  viewport  Down     Align bottom edge of content & viewport
+    // 3 Below viewport   <= viewport  Up       Align bottom edge of content & viewport
+    // 4 Below viewport   >  viewport  Up       Align top edge of content & viewport
+    // 5 Entirely within viewport      NA       No change
+    // 6 Spanning viewport             NA       No change
+    if ((above && !larger) || (below && larger))
+    {
+        // Cases 1 & 4
+        return childStart;
+    }
+    else if (above || below)
+    {
+        // Cases 2 & 3
+        return childEnd - viewportEnd + viewportStart;
+    }
+
+    // cases 5 & 6
+    return viewportStart;
+}
+
+void ApplyAlignmentRatio(
+    double alignmentRatio,
+    double viewport,
+    double zoomFactor,
+    double* targetStart,
+    double* targetLength)
+{
+    if (!std::isnan(alignmentRatio))
+    {
+        assert(alignmentRatio >= 0.0 && alignmentRatio <= 1.0);
+
+        *targetStart += (*targetLength - viewport / zoomFactor) * alignmentRatio;
+        *targetLength = viewport / zoomFactor;
+    }
+}
+
+double ComputeBringIntoViewTargetOffset(
+    double zoomedOffset,
+    double viewport,
+    double zoomFactor,
+    double scrollableSize,
+    double targetStart,
+    double targetLength,
+    double requestedOffset,
+    double* appliedOffset)
+{
+    double targetOffset = ComputeZoomedOffsetWithMinimalChange(
+        zoomedOffset,
+        zoomedOffset + viewport,
+        targetStart * zoomFactor,
+        (targetStart + targetLength) * zoomFactor);
+
+    targetOffset = std::clamp(targetOffset, 0.0, scrollableSize);
+
+    *appliedOffset = 0.0;
+
+    // If the target offset is within bounds and an offset was provided, apply as much of it as possible while remaining within bounds.
+    if (requestedOffset != 0.0 && targetOffset >= 0.0 && targetOffset <= scrollableSize)
+    {
+        if (requestedOffset > 0.0)
+        {
+            *appliedOffset = std::min(targetOffset, requestedOffset);
+        }
+        else
+        {
+            *appliedOffset = -std::min(scrollableSize - targetOffset, -requestedOffset);
+        }
+        targetOffset -= *appliedOffset;
+    }
+
+    assert(targetOffset >= 0.0);
+    assert(targetOffset <= scrollableSize);
+
+    return targetOffset;
+}
+
+}
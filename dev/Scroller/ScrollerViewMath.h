@@ -0,0 +1,60 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Arithmetic behind the Scroller's view changes, free of any XAML, Composition or
+// InteractionTracker dependency so it can be exercised in isolation. The Scroller
+// gathers its inputs (extents, viewport sizes, zoom factor, alignments) and applies
+// the results. This header and ScrollerViewMath.cpp only depend on the standard
+// library and do not use the precompiled header.
+namespace ScrollerViewMath
+{
+    // Alignment of the Content along one dimension. Stretch behaves like Center.
+    enum class ContentAlignment
+    {
+        Start,
+        Center,
+        End
+    };
+
+    // Computes the zoomed InteractionTracker min and max positions along one dimension, excluding
+    // the Content's layout offset. Either output may be null.
+    void ComputeMinMaxPosition(
+        ContentAlignment alignment,
+        float unzoomedExtent,
+        float viewport,
+        float zoomFactor,
+        float* minPosition,
+        float* maxPosition);
+
+    // Returns the viewport start that brings the [childStart, childEnd] range into view with
+    // the smallest displacement.
+    double ComputeZoomedOffsetWithMinimalChange(
+        double viewportStart,
+        double viewportEnd,
+        double childStart,
+        double childEnd);
+
+    // Widens or narrows the unzoomed [targetStart, targetStart + targetLength] range to the
+    // viewport size, positioned according to alignmentRatio. No-op when alignmentRatio is NaN.
+    void ApplyAlignmentRatio(
+        double alignmentRatio,
+        double viewport,
+        double zoomFactor,
+        double* targetStart,
+        double* targetLength);
+
+    // Returns the zoomed offset, within [0, scrollableSize], that brings the unzoomed target range
+    // into view, minus as much of requestedOffset as the boundaries allow. That applied portion
+    // is returned in appliedOffset.
+    double ComputeBringIntoViewTargetOffset(
+        double zoomedOffset,
+        double viewport,
+        double zoomFactor,
+        double scrollableSize,
+        double targetStart,
+        double targetLength,
+        double requestedOffset,
+        double* appliedOffset);
+}
@@ -0,0 +1,56 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+// Subset of the InteractionTracker surface the Scroller's view changes rely on, expressed with
+// standard types only. NativeTests/ScrollerViewSimulator implements it on the CPU so the view
+// arithmetic of ScrollerViewMath can be driven deterministically, without Composition.
+namespace ScrollerViewMath
+{
+    struct TrackerVector
+    {
+        float X{ 0.0f };
+        float Y{ 0.0f };
+    };
+
+    enum class TrackerDimension
+    {
+        Horizontal,
+        Vertical
+    };
+
+    // Counterpart of InteractionTrackerInertiaRestingValue: the first modifier whose Condition
+    // accepts the natural resting position replaces it with its RestingValue.
+    struct TrackerInertiaModifier
+    {
+        std::function<bool(float naturalRestingPosition)> Condition;
+        std::function<float(float naturalRestingPosition)> RestingValue;
+    };
+
+    // Requests are identified like InteractionTracker requests: the returned id is positive and
+    // increasing, and the request takes effect on the next tick of the implementation.
+    class ScrollerViewTracker
+    {
+    public:
+        virtual ~ScrollerViewTracker() = default;
+
+        virtual TrackerVector Position() const = 0;
+        virtual float Scale() const = 0;
+        virtual TrackerVector MinPosition() const = 0;
+        virtual TrackerVector MaxPosition() const = 0;
+        virtual bool IsIdle() const = 0;
+
+        // Fraction of the velocity lost per second during inertia, in (0, 1).
+        virtual void PositionInertiaDecayRate(float decayRate) = 0;
+        virtual void InertiaModifiers(TrackerDimension dimension, std::vector<TrackerInertiaModifier> modifiers) = 0;
+
+        virtual int TryUpdatePosition(TrackerVector position) = 0;
+        virtual int TryUpdatePositionBy(TrackerVector delta) = 0;
+        virtual int TryUpdatePositionWithAdditionalVelocity(TrackerVector velocity) = 0;
+        virtual int TryUpdateScale(float scale, TrackerVector centerPoint) = 0;
+    };
+}
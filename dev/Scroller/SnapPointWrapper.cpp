@@ -30,12 +30,30 @@ std::tuple<double, double> SnapPointWrapper<T>::ActualApplicableZone() const
     return m_actualApplicableZone;
 }
 
+template<typename T>
+std::tuple<double, double> SnapPointWrapper<T>::ActualImpulseApplicableZone() const
+{
+    return m_actualImpulseApplicableZone;
+}
+
 template<typename T>
 int SnapPointWrapper<T>::CombinationCount() const
 {
     return m_combinationCount;
 }
 
+template<typename T>
+std::shared_ptr<CompositeSnapPointWrapper<T>> SnapPointWrapper<T>::Composite() const
+{
+    return m_composite;
+}
+
+template<typename T>
+void SnapPointWrapper<T>::Composite(std::shared_ptr<CompositeSnapPointWrapper<T>> const& composite)
+{
+    m_composite = composite;
+}
+
 template<typename T>
 bool SnapPointWrapper<T>::ResetIgnoredValue()
 {
@@ -205,9 +223,18 @@ template winrt::ZoomSnapPointBase SnapPointWrapper<winrt::ZoomSnapPointBase>::Sn
 template std::tuple<double, double> SnapPointWrapper<winrt::ScrollSnapPointBase>::ActualApplicableZone() const;
 template std::tuple<double, double> SnapPointWrapper<winrt::ZoomSnapPointBase>::ActualApplicableZone() const;
 
+template std::tuple<double, double> SnapPointWrapper<winrt::ScrollSnapPointBase>::ActualImpulseApplicableZone() const;
+template std::tuple<double, double> SnapPointWrapper<winrt::ZoomSnapPointBase>::ActualImpulseApplicableZone() const;
+
 template int SnapPointWrapper<winrt::ScrollSnapPointBase>::CombinationCount() const;
 template int SnapPointWrapper<winrt::ZoomSnapPointBase>::CombinationCount() const;
 
+template std::shared_ptr<CompositeSnapPointWrapper<winrt::ScrollSnapPointBase>> SnapPointWrapper<winrt::ScrollSnapPointBase>::Composite() const;
+template std::shared_ptr<CompositeSnapPointWrapper<winrt::ZoomSnapPointBase>> SnapPointWrapper<winrt::ZoomSnapPointBase>::Composite() const;
+
+template void SnapPointWrapper<winrt::ScrollSnapPointBase>::Composite(std::shared_ptr<CompositeSnapPointWrapper<winrt::ScrollSnapPointBase>> const& composite);
+template void SnapPointWrapper<winrt::ZoomSnapPointBase>::Composite(std::shared_ptr<CompositeSnapPointWrapper<winrt::ZoomSnapPointBase>> const& composite);
+
 template bool SnapPointWrapper<winrt::ScrollSnapPointBase>::ResetIgnoredValue();
 template bool SnapPointWrapper<winrt::ZoomSnapPointBase>::ResetIgnoredValue();
 
@@ -263,3 +290,5 @@ template bool SnapPointWrapper<winrt::ZoomSnapPointBase>::SnapsAt(double value)
 
 template SnapPointBase* SnapPointWrapper<winrt::ScrollSnapPointBase>::GetSnapPointFromWrapper(std::shared_ptr<SnapPointWrapper<winrt::ScrollSnapPointBase>> snapPointWrapper);
 template SnapPointBase* SnapPointWrapper<winrt::ZoomSnapPointBase>::GetSnapPointFromWrapper(std::shared_ptr<SnapPointWrapper<winrt::ZoomSnapPointBase>> snapPointWrapper);
+template SnapPointBase* SnapPointWrapper<winrt::ScrollSnapPointBase>::GetSnapPointFromWrapper(const SnapPointWrapper<winrt::ScrollSnapPointBase>* snapPointWrapper);
+template SnapPointBase* SnapPointWrapper<winrt::ZoomSnapPointBase>::GetSnapPointFromWrapper(const SnapPointWrapper<winrt::ZoomSnapPointBase>* snapPointWrapper);
@@ -5,6 +5,8 @@
 
 #include "ScrollerSnapPoint.h"
 
+template <typename T> class CompositeSnapPointWrapper;
+
 // The SnapPointWrapper class has a SnapPointBase member that can be shared among multiple
 // HorizontalSnapPoints, VerticalSnapPoints and ZoomSnapPoints collections.
 // It also includes all the data that is specific to that snap point and a particular collection.
@@ -20,7 +22,10 @@ public:
 
     T SnapPoint() const;
     std::tuple<double, double> ActualApplicableZone() const;
+    std::tuple<double, double> ActualImpulseApplicableZone() const;
     int CombinationCount() const;
+    std::shared_ptr<CompositeSnapPointWrapper<T>> Composite() const;
+    void Composite(std::shared_ptr<CompositeSnapPointWrapper<T>> const& composite);
     bool ResetIgnoredValue();
     void SetIgnoredValue(double ignoredValue);
 
@@ -46,9 +51,7 @@ public:
     bool SnapsAt(double value) const;
 
     static SnapPointBase* GetSnapPointFromWrapper(std::shared_ptr<SnapPointWrapper<T>> snapPointWrapper);
-
-private:
-	static SnapPointBase* GetSnapPointFromWrapper(const SnapPointWrapper<T>* snapPointWrapper);
+    static SnapPointBase* GetSnapPointFromWrapper(const SnapPointWrapper<T>* snapPointWrapper);
 
 private:
     T m_snapPoint;
@@ -58,6 +61,8 @@ private:
     double m_ignoredValue{ NAN }; // Ignored snapping value when inertia is triggered by an impulse
     winrt::ExpressionAnimation m_conditionExpressionAnimation{ nullptr };
     winrt::ExpressionAnimation m_restingValueExpressionAnimation{ nullptr };
+    // Set when this snap point is handed to the InteractionTracker as part of a composite inertia modifier.
+    std::shared_ptr<CompositeSnapPointWrapper<T>> m_composite{ nullptr };
 };
 
 template <typename T>
@@ -73,3 +78,93 @@ struct SnapPointWrapperComparator
         return *leftSnapPoint < rightSnapPoint;
     }
 };
+
+// Contiguous copy of the actual applicable zones of a sorted and consolidated snap points set, in the set's order.
+// The zones of neighboring snap points do not overlap, so the snap point whose zone contains a value is found with
+// a binary search rather than a walk through the set. The entries point to wrappers owned by the set and must be
+// invalidated whenever the set's content changes.
+template <typename T>
+class SnapPointZones
+{
+public:
+    bool IsValid() const
+    {
+        return m_isValid;
+    }
+
+    void Invalidate()
+    {
+        m_zones.clear();
+        m_isValid = false;
+    }
+
+    // Captures the current actual applicable zones. The index stays invalid when the zones' start or end
+    // values are not in ascending order, in which case callers fall back to walking the set.
+    void Update(std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>> const& snapPointsSet)
+    {
+        Invalidate();
+        m_zones.reserve(snapPointsSet.size());
+
+        for (auto const& snapPointWrapper : snapPointsSet)
+        {
+            auto const [start, end] = snapPointWrapper->ActualApplicableZone();
+
+            if (!m_zones.empty() && (start < m_zones.back().start || end < m_zones.back().end))
+            {
+                m_zones.clear();
+                return;
+            }
+
+            m_zones.push_back({ start, end, snapPointWrapper.get() });
+        }
+
+        m_isValid = true;
+    }
+
+    // Returns the first snap point, in the set's order, whose actual applicable zone includes the provided value.
+    SnapPointWrapper<T>* FindZone(double value) const
+    {
+        MUX_ASSERT(m_isValid);
+
+        auto it = FirstZoneEndingAtOrAfter(value);
+
+        return (it != m_zones.end() && it->start <= value) ? it->snapPointWrapper : nullptr;
+    }
+
+    // Returns the first snap point, in the set's order, that snaps around the provided value.
+    // Only the zones that include the value are visited.
+    SnapPointWrapper<T>* FindSnappingZone(double value) const
+    {
+        MUX_ASSERT(m_isValid);
+
+        for (auto it = FirstZoneEndingAtOrAfter(value); it != m_zones.end() && it->start <= value; it++)
+        {
+            if (it->snapPointWrapper->SnapsAt(value))
+            {
+                return it->snapPointWrapper;
+            }
+        }
+
+        return nullptr;
+    }
+
+private:
+    struct Zone
+    {
+        double start;
+        double end;
+        SnapPointWrapper<T>* snapPointWrapper;
+    };
+
+    typename std::vector<Zone>::const_iterator FirstZoneEndingAtOrAfter(double value) const
+    {
+        return std::lower_bound(
+            m_zones.begin(),
+            m_zones.end(),
+            value,
+            [](const Zone& zone, double value) { return zone.end < value; });
+    }
+
+    std::vector<Zone> m_zones;
+    bool m_isValid{ false };
+};
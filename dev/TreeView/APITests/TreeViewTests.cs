@@ -238,6 +238,164 @@ namespace Windows.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        public void TreeViewLargeTreeExpandCollapseTest()
+        {
+            TreeView treeView = null;
+            TreeViewList listControl = null;
+            var loadedWaiter = new ManualResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                treeView = new TreeView();
+                treeView.Loaded += (object sender, RoutedEventArgs e) =>
+                {
+                    listControl = FindVisualChildByName(treeView, "ListControl") as TreeViewList;
+                    loadedWaiter.Set();
+                };
+
+                MUXControlsTestApp.App.TestContentRoot = treeView;
+            });
+
+            Verify.IsTrue(loadedWaiter.WaitOne(TimeSpan.FromMinutes(1)), "Check if Loaded was successfully raised");
+            RunOnUIThread.Execute(() =>
+            {
+                // 100 groups of 100 items with 10 sub items each, 101,100 nodes in total.
+                const int groupCount = 100;
+                const int itemCount = 100;
+                const int subItemCount = 10;
+                var root = new TreeViewNode() { Content = "Root" };
+                for (int i = 0; i < groupCount; i++)
+                {
+                    var group = new TreeViewNode() { Content = "Group " + i };
+                    for (int j = 0; j < itemCount; j++)
+                    {
+                        var item = new TreeViewNode() { Content = "Item " + i + "." + j };
+                        for (int k = 0; k < subItemCount; k++)
+                        {
+                            item.Children.Add(new TreeViewNode() { Content = "Sub item " + i + "." + j + "." + k });
+                        }
+
+                        group.Children.Add(item);
+                    }
+
+                    root.Children.Add(group);
+                }
+
+                treeView.RootNodes.Add(root);
+                var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+                treeView.Expand(root);
+                foreach (var group in root.Children)
+                {
+                    group.IsExpanded = true;
+                    foreach (var item in group.Children)
+                    {
+                        item.IsExpanded = true;
+                    }
+                }
+                Log.Comment(string.Format("Expand all: {0}ms", stopwatch.ElapsedMilliseconds));
+                int expectedCount = 1 + groupCount * (1 + itemCount * (1 + subItemCount));
+                Verify.AreEqual(expectedCount, listControl.Items.Count);
+
+                var lastGroup = root.Children[groupCount - 1];
+                var middleItem = root.Children[groupCount / 2].Children[itemCount / 2];
+                Verify.AreEqual(lastGroup, listControl.Items[expectedCount - 1 - itemCount * (1 + subItemCount)]);
+                Verify.AreEqual(middleItem.Children[0], listControl.Items[listControl.Items.IndexOf(middleItem) + 1]);
+
+                // Insert and remove in the middle of an expanded group.
+                stopwatch.Restart();
+                var inserted = new TreeViewNode() { Content = "Inserted" };
+                root.Children[groupCount / 2].Children.Insert(itemCount / 2, inserted);
+                Verify.AreEqual(middleItem, listControl.Items[listControl.Items.IndexOf(inserted) + 1]);
+                root.Children[groupCount / 2].Children.Remove(inserted);
+                Log.Comment(string.Format("Insert and remove: {0}ms", stopwatch.ElapsedMilliseconds));
+                Verify.AreEqual(expectedCount, listControl.Items.Count);
+
+                stopwatch.Restart();
+                for (int i = groupCount - 1; i >= 0; i -= 2)
+                {
+                    root.Children[i].IsExpanded = false;
+                }
+                Log.Comment(string.Format("Collapse every other group: {0}ms", stopwatch.ElapsedMilliseconds));
+                expectedCount -= (groupCount / 2) * itemCount * (1 + subItemCount);
+                Verify.AreEqual(expectedCount, listControl.Items.Count);
+                Verify.AreEqual(lastGroup, listControl.Items[expectedCount - 1]);
+
+                stopwatch.Restart();
+                treeView.Collapse(root);
+                Log.Comment(string.Format("Collapse root: {0}ms", stopwatch.ElapsedMilliseconds));
+                Verify.AreEqual(1, listControl.Items.Count);
+
+                // Put things back
+                MUXControlsTestApp.App.TestContentRoot = null;
+            });
+        }
+
+        [TestMethod]
+        [TestProperty("Description", "Verifies the flattened node list reports up to date indices from its VectorChanged handlers.")]
+        public void TreeViewIndexOfDuringVectorChangedTest()
+        {
+            TreeView treeView = null;
+            TreeViewList listControl = null;
+            var loadedWaiter = new ManualResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                treeView = new TreeView();
+                treeView.Loaded += (object sender, RoutedEventArgs e) =>
+                {
+                    listControl = FindVisualChildByName(treeView, "ListControl") as TreeViewList;
+                    loadedWaiter.Set();
+                };
+
+                MUXControlsTestApp.App.TestContentRoot = treeView;
+            });
+
+            Verify.IsTrue(loadedWaiter.WaitOne(TimeSpan.FromMinutes(1)), "Check if Loaded was successfully raised");
+            RunOnUIThread.Execute(() =>
+            {
+                var root = new TreeViewNode() { Content = "Root" };
+                for (int i = 0; i < 5; i++)
+                {
+                    root.Children.Add(new TreeViewNode() { Content = "Item " + i });
+                }
+
+                treeView.RootNodes.Add(root);
+                treeView.Expand(root);
+
+                var flatNodes = listControl.ItemsSource as IObservableVector<object>;
+                Verify.IsNotNull(flatNodes);
+
+                TreeViewNode removed = null;
+                int checkedChanges = 0;
+                flatNodes.VectorChanged += (sender, args) =>
+                {
+                    int index = (int)args.Index;
+                    if (args.CollectionChange == CollectionChange.ItemInserted)
+                    {
+                        Verify.AreEqual(index, sender.IndexOf(sender[index]));
+                        checkedChanges++;
+                    }
+                    else if (args.CollectionChange == CollectionChange.ItemRemoved)
+                    {
+                        Verify.AreEqual(-1, sender.IndexOf(removed));
+                        checkedChanges++;
+                    }
+                };
+
+                var inserted = new TreeViewNode() { Content = "Inserted" };
+                root.Children.Insert(2, inserted);
+                removed = inserted;
+                root.Children.Remove(inserted);
+                removed = root.Children[root.Children.Count - 1];
+                root.Children.RemoveAt(root.Children.Count - 1);
+                Verify.AreEqual(3, checkedChanges);
+
+                // Put things back
+                MUXControlsTestApp.App.TestContentRoot = null;
+            });
+        }
+
         [TestMethod]
         public void TreeViewInheritanceTest()
         {
@@ -0,0 +1,261 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "common.h"
+#include "FlatTreeIndex.h"
+
+uint32_t FlatTreeIndex::Size() const
+{
+    return SizeOf(m_root);
+}
+
+void FlatTreeIndex::InsertAt(uint32_t index, TreeViewNode* node, int depth)
+{
+    MUX_ASSERT(index <= Size());
+
+    const int entry = Allocate(node, depth);
+    int left = s_none;
+    int right = s_none;
+    Split(m_root, index, left, right);
+    m_root = Merge(Merge(left, entry), right);
+    m_entries[m_root].Parent = s_none;
+}
+
+void FlatTreeIndex::RemoveAt(uint32_t index)
+{
+    MUX_ASSERT(index < Size());
+
+    int left = s_none;
+    int rest = s_none;
+    int removed = s_none;
+    int right = s_none;
+    Split(m_root, index, left, rest);
+    Split(rest, 1, removed, right);
+
+    // The same node can only be in the list once, but do not lose track of a newer entry
+    // for it if that was ever violated.
+    const auto it = m_entryOfNode.find(m_entries[removed].Node);
+    if (it != m_entryOfNode.end() && it->second == removed)
+    {
+        m_entryOfNode.erase(it);
+    }
+
+    m_entries[removed].Node = nullptr;
+    m_freeEntries.push_back(removed);
+
+    m_root = Merge(left, right);
+    if (m_root != s_none)
+    {
+        m_entries[m_root].Parent = s_none;
+    }
+}
+
+void FlatTreeIndex::SetAt(uint32_t index, TreeViewNode* node, int depth)
+{
+    const int entry = FindAt(index);
+    const auto it = m_entryOfNode.find(m_entries[entry].Node);
+    if (it != m_entryOfNode.end() && it->second == entry)
+    {
+        m_entryOfNode.erase(it);
+    }
+
+    m_entries[entry].Node = node;
+    m_entries[entry].Depth = depth;
+    m_entryOfNode[node] = entry;
+
+    for (int current = entry; current != s_none; current = m_entries[current].Parent)
+    {
+        Update(current);
+    }
+}
+
+void FlatTreeIndex::Clear()
+{
+    m_entries.clear();
+    m_freeEntries.clear();
+    m_entryOfNode.clear();
+    m_root = s_none;
+}
+
+bool FlatTreeIndex::IndexOf(TreeViewNode* node, uint32_t& index) const
+{
+    const auto it = m_entryOfNode.find(node);
+    if (it == m_entryOfNode.end())
+    {
+        return false;
+    }
+
+    int entry = it->second;
+    index = SizeOf(m_entries[entry].Left);
+    while (m_entries[entry].Parent != s_none)
+    {
+        const int parent = m_entries[entry].Parent;
+        if (m_entries[parent].Right == entry)
+        {
+            index += SizeOf(m_entries[parent].Left) + 1;
+        }
+
+        entry = parent;
+    }
+
+    return true;
+}
+
+int FlatTreeIndex::DepthAt(uint32_t index) const
+{
+    return m_entries[FindAt(index)].Depth;
+}
+
+uint32_t FlatTreeIndex::SubtreeEnd(uint32_t index) const
+{
+    const int found = FindFirstNotDeeper(m_root, 0, index + 1, DepthAt(index));
+    return found == s_none ? Size() : static_cast<uint32_t>(found);
+}
+
+int FlatTreeIndex::FindAt(uint32_t index) const
+{
+    MUX_ASSERT(index < Size());
+
+    int entry = m_root;
+    while (true)
+    {
+        const uint32_t leftSize = SizeOf(m_entries[entry].Left);
+        if (index < leftSize)
+        {
+            entry = m_entries[entry].Left;
+        }
+        else if (index == leftSize)
+        {
+            return entry;
+        }
+        else
+        {
+            index -= leftSize + 1;
+            entry = m_entries[entry].Right;
+        }
+    }
+}
+
+// Returns the position of the first entry at or after start whose depth is at most depth,
+// skipping every subtree whose smallest depth is greater.
+int FlatTreeIndex::FindFirstNotDeeper(int entry, uint32_t offset, uint32_t start, int depth) const
+{
+    if (entry == s_none ||
+        m_entries[entry].MinDepth > depth ||
+        offset + m_entries[entry].Size <= start)
+    {
+        return s_none;
+    }
+
+    const auto& current = m_entries[entry];
+    const int found = FindFirstNotDeeper(current.Left, offset, start, depth);
+    if (found != s_none)
+    {
+        return found;
+    }
+
+    const uint32_t position = offset + SizeOf(current.Left);
+    if (position >= start && current.Depth <= depth)
+    {
+        return static_cast<int>(position);
+    }
+
+    return FindFirstNotDeeper(current.Right, position + 1, start, depth);
+}
+
+void FlatTreeIndex::Update(int entry)
+{
+    auto& current = m_entries[entry];
+    current.Size = 1;
+    current.MinDepth = current.Depth;
+    for (const int child : { current.Left, current.Right })
+    {
+        if (child != s_none)
+        {
+            current.Size += m_entries[child].Size;
+            current.MinDepth = std::min(current.MinDepth, m_entries[child].MinDepth);
+            m_entries[child].Parent = entry;
+        }
+    }
+}
+
+// Splits the subtree at entry into its first count entries and the rest.
+void FlatTreeIndex::Split(int entry, uint32_t count, int& left, int& right)
+{
+    if (entry == s_none)
+    {
+        left = s_none;
+        right = s_none;
+        return;
+    }
+
+    auto& current = m_entries[entry];
+    const uint32_t leftSize = SizeOf(current.Left);
+    if (leftSize < count)
+    {
+        Split(current.Right, count - leftSize - 1, current.Right, right);
+        left = entry;
+    }
+    else
+    {
+        Split(current.Left, count, left, current.Left);
+        right = entry;
+    }
+
+    Update(entry);
+}
+
+int FlatTreeIndex::Merge(int left, int right)
+{
+    if (left == s_none)
+    {
+        return right;
+    }
+
+    if (right == s_none)
+    {
+        return left;
+    }
+
+    if (m_entries[left].Priority > m_entries[right].Priority)
+    {
+        const int merged = Merge(m_entries[left].Right, right);
+        m_entries[left].Right = merged;
+        Update(left);
+        return left;
+    }
+
+    const int merged = Merge(left, m_entries[right].Left);
+    m_entries[right].Left = merged;
+    Update(right);
+    return right;
+}
+
+int FlatTreeIndex::Allocate(TreeViewNode* node, int depth)
+{
+    int entry = s_none;
+    if (!m_freeEntries.empty())
+    {
+        entry = m_freeEntries.back();
+        m_freeEntries.pop_back();
+    }
+    else
+    {
+        entry = static_cast<int>(m_entries.size());
+        m_entries.emplace_back();
+    }
+
+    m_entries[entry] = Entry{ node, depth, depth, 1, NextPriority(), s_none, s_none, s_none };
+    m_entryOfNode[node] = entry;
+    return entry;
+}
+
+uint32_t FlatTreeIndex::NextPriority()
+{
+    // xorshift32, the treap only needs the priorities to look random.
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 17;
+    m_seed ^= m_seed << 5;
+    return m_seed;
+}
@@ -0,0 +1,57 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+class TreeViewNode;
+
+// Order statistic tree over the flat list of nodes that the ViewModel shows. Every entry knows
+// the size of its subtree, so the flat index of a node is found in O(log n) by walking up from
+// its entry, and the smallest depth in its subtree, so the end of the range covered by a node
+// and its visible descendants is found in O(log n) as well. The tree is a treap keyed by
+// position; entries live in a pool and refer to each other by their position in it.
+class FlatTreeIndex final
+{
+public:
+    uint32_t Size() const;
+    void InsertAt(uint32_t index, TreeViewNode* node, int depth);
+    void RemoveAt(uint32_t index);
+    void SetAt(uint32_t index, TreeViewNode* node, int depth);
+    void Clear();
+
+    bool IndexOf(TreeViewNode* node, uint32_t& index) const;
+    int DepthAt(uint32_t index) const;
+    // One past the last entry that follows index with a greater depth, which is the end of the
+    // visible descendants of the node at index.
+    uint32_t SubtreeEnd(uint32_t index) const;
+
+private:
+    struct Entry
+    {
+        TreeViewNode* Node;
+        int Depth;
+        int MinDepth;
+        uint32_t Size;
+        uint32_t Priority;
+        int Left;
+        int Right;
+        int Parent;
+    };
+
+    static constexpr int s_none = -1;
+
+    uint32_t SizeOf(int entry) const { return entry == s_none ? 0 : m_entries[entry].Size; }
+    int FindAt(uint32_t index) const;
+    int FindFirstNotDeeper(int entry, uint32_t offset, uint32_t start, int depth) const;
+    void Update(int entry);
+    void Split(int entry, uint32_t count, int& left, int& right);
+    int Merge(int left, int right);
+    int Allocate(TreeViewNode* node, int depth);
+    uint32_t NextPriority();
+
+    std::vector<Entry> m_entries;
+    std::vector<int> m_freeEntries;
+    std::unordered_map<TreeViewNode*, int> m_entryOfNode;
+    int m_root{ s_none };
+    uint32_t m_seed{ 0x9E3779B9 };
+};
@@ -196,11 +196,16 @@ bool ViewModel::IndexOf(winrt::IInspectable const& value, uint32_t& index)
     {
         return indexOfFunction(value, index);
     }
-    else
+    else if (!IsContentMode())
     {
-        auto inner = GetVectorInnerImpl();
-        return inner->IndexOf(value, index);
+        if (auto node = value.try_as<winrt::TreeViewNode>())
+        {
+            return IndexOfNode(node, index);
+        }
     }
+
+    auto inner = GetVectorInnerImpl();
+    return inner->IndexOf(value, index);
 }
 
 uint32_t ViewModel::GetMany(uint32_t const startIndex, winrt::array_view<winrt::IInspectable> values)
@@ -234,10 +239,13 @@ void ViewModel::SetAt(uint32_t index, winrt::IInspectable const& value)
 {
     auto inner = GetVectorInnerImpl();
     auto current = inner->GetAt(index).as<winrt::TreeViewNode>();
-    inner->SetAt(index, value);
-
     winrt::TreeViewNode newNode = value.as<winrt::TreeViewNode>();
 
+    // Keep m_flatTree ahead of the inner vector, which raises VectorChanged synchronously,
+    // so that IndexOf/IndexOfNode are accurate from within the handlers.
+    m_flatTree.SetAt(index, winrt::get_self<TreeViewNode>(newNode), newNode.Depth());
+    inner->SetAt(index, value);
+
     auto tvnCurrent = winrt::get_self<TreeViewNode>(current);
     tvnCurrent->ChildrenChanged(m_collectionChangedEventTokenVector[index]);
     tvnCurrent->RemoveExpandedChanged(m_IsExpandedChangedEventTokenVector[index]);
@@ -250,8 +258,15 @@ void ViewModel::SetAt(uint32_t index, winrt::IInspectable const& value)
 
 void ViewModel::InsertAt(uint32_t index, winrt::IInspectable const& value)
 {
-    GetVectorInnerImpl()->InsertAt(index, value);
+    auto inner = GetVectorInnerImpl();
+    if (index > inner->Size())
+    {
+        throw winrt::hresult_out_of_bounds();
+    }
+
     winrt::TreeViewNode newNode = value.as<winrt::TreeViewNode>();
+    m_flatTree.InsertAt(index, winrt::get_self<TreeViewNode>(newNode), newNode.Depth());
+    inner->InsertAt(index, value);
 
     //Hook up events and save tokens
     auto tvnNewNode = winrt::get_self<TreeViewNode>(newNode);
@@ -263,6 +278,7 @@ void ViewModel::RemoveAt(uint32_t index)
 {
     auto inner = GetVectorInnerImpl();
     auto current = inner->GetAt(index).as<winrt::TreeViewNode>();
+    m_flatTree.RemoveAt(index);
     inner->RemoveAt(index);
 
     // Unhook event handlers
@@ -277,8 +293,9 @@ void ViewModel::RemoveAt(uint32_t index)
 
 void ViewModel::Append(winrt::IInspectable const& value)
 {
-    GetVectorInnerImpl()->Append(value);
     winrt::TreeViewNode newNode = value.as<winrt::TreeViewNode>();
+    m_flatTree.InsertAt(m_flatTree.Size(), winrt::get_self<TreeViewNode>(newNode), newNode.Depth());
+    GetVectorInnerImpl()->Append(value);
     
     // Hook up events and save tokens
     auto tvnNewNode = winrt::get_self<TreeViewNode>(newNode);
@@ -290,6 +307,7 @@ void ViewModel::RemoveAtEnd()
 {
     auto inner = GetVectorInnerImpl();
     auto current = inner->GetAt(Size() - 1).as<winrt::TreeViewNode>();
+    m_flatTree.RemoveAt(m_flatTree.Size() - 1);
     inner->RemoveAtEnd();
 
     // unhook events
@@ -315,8 +333,15 @@ void ViewModel::Clear()
 
 void ViewModel::ReplaceAll(winrt::array_view<winrt::IInspectable const> items)
 {
+    m_flatTree.Clear();
+    for (auto const& item : items)
+    {
+        auto node = item.as<winrt::TreeViewNode>();
+        m_flatTree.InsertAt(m_flatTree.Size(), winrt::get_self<TreeViewNode>(node), node.Depth());
+    }
+
     auto inner = GetVectorInnerImpl();
-    return inner->ReplaceAll(items);
+    inner->ReplaceAll(items);
 }
 
 // Helper function
@@ -389,7 +414,13 @@ int ViewModel::AddNodeDescendantsToView(const winrt::TreeViewNode& value, unsign
 void ViewModel::RemoveNodeAndDescendantsFromView(const winrt::TreeViewNode& value)
 {
     UINT32 valueIndex;
-    if (value.IsExpanded())
+    bool containsValue = IndexOfNode(value, valueIndex);
+    if (containsValue)
+    {
+        // The node is followed by its visible descendants, remove the whole range from the end.
+        RemoveNodesAndDescendentsWithFlatIndexRange(valueIndex, m_flatTree.SubtreeEnd(valueIndex) - 1);
+    }
+    else if (value.IsExpanded())
     {
         unsigned int size = value.Children().Size();
         for (unsigned int i = 0; i < size; i++)
@@ -398,21 +429,16 @@ void ViewModel::RemoveNodeAndDescendantsFromView(const winrt::TreeViewNode& valu
             RemoveNodeAndDescendantsFromView(childNode);
         }
     }
-
-    bool containsValue = IndexOfNode(value, valueIndex);
-    if (containsValue)
-    {
-        RemoveAt(valueIndex);
-    }
 }
 
 void ViewModel::RemoveNodesAndDescendentsWithFlatIndexRange(unsigned int lowIndex, unsigned int highIndex)
 {
     MUX_ASSERT(lowIndex <= highIndex);
 
+    // The range holds complete subtrees, so every descendant of a node in it is in it as well.
     for (int i = static_cast<int>(highIndex); i >= static_cast<int>(lowIndex); i--)
     {
-        RemoveNodeAndDescendantsFromView(GetNodeAt(i));
+        RemoveAt(i);
     }
 }
 
@@ -440,6 +466,13 @@ int ViewModel::GetNextIndexInFlatTree(const winrt::TreeViewNode& node)
 //   then add offset and finally return TreeViewNode by looking up the flat tree.
 winrt::TreeViewNode ViewModel::GetRemovedChildTreeViewNodeByIndex(winrt::TreeViewNode const& node, unsigned int childIndex)
 {
+    // The previous sibling did not move, the removed child was right after its visible descendants.
+    unsigned int previousSiblingIndex;
+    if (childIndex > 0 && IndexOfNode(node.Children().GetAt(childIndex - 1), previousSiblingIndex))
+    {
+        return GetNodeAt(m_flatTree.SubtreeEnd(previousSiblingIndex));
+    }
+
     unsigned int allOpenedDescendantsCount = 0;
     for (unsigned int i = 0; i < childIndex; i++)
     {
@@ -456,6 +489,13 @@ winrt::TreeViewNode ViewModel::GetRemovedChildTreeViewNodeByIndex(winrt::TreeVie
 
 int ViewModel::CountDescendants(const winrt::TreeViewNode& value)
 {
+    unsigned int valueIndex;
+    if (value.IsExpanded() && IndexOfNode(value, valueIndex))
+    {
+        // The descendants of an expanded node in the view are the range that follows it.
+        return static_cast<int>(m_flatTree.SubtreeEnd(valueIndex) - valueIndex - 1);
+    }
+
     int descendantCount = 0;
     unsigned int size = value.Children().Size();
     for (unsigned int i = 0; i < size; i++)
@@ -508,17 +548,7 @@ unsigned int ViewModel::IndexOfNextSibling(winrt::TreeViewNode& childNode)
 
 unsigned int ViewModel::GetExpandedDescendantCount(winrt::TreeViewNode& parentNode)
 {
-    unsigned int allOpenedDescendantsCount = 0;
-    for (unsigned int i = 0; i < parentNode.Children().Size(); i++)
-    {
-        auto childNode = parentNode.Children().GetAt(i).as<winrt::TreeViewNode>();
-        allOpenedDescendantsCount++;
-        if (childNode.IsExpanded())
-        {
-            allOpenedDescendantsCount += CountDescendants(childNode);
-        }
-    }
-    return allOpenedDescendantsCount;
+    return static_cast<unsigned int>(CountDescendants(parentNode));
 }
 
 bool ViewModel::IsNodeSelected(winrt::TreeViewNode const& targetNode)
@@ -653,7 +683,7 @@ winrt::IVector<winrt::TreeViewNode> ViewModel::GetSelectedNodes()
 
 bool ViewModel::IndexOfNode(winrt::TreeViewNode const& targetNode, uint32_t& index)
 {
-    return GetVectorInnerImpl()->IndexOf(targetNode, index);
+    return targetNode && m_flatTree.IndexOf(winrt::get_self<TreeViewNode>(targetNode), index);
 }
 
 void ViewModel::TreeViewNodeVectorChanged(winrt::TreeViewNode const& sender, winrt::IInspectable const& args)
@@ -696,8 +726,19 @@ void ViewModel::TreeViewNodeVectorChanged(winrt::TreeViewNode const& sender, win
         auto parentNode = targetNode.Parent();
         unsigned int nextNodeIndex = GetNextIndexInFlatTree(parentNode);
         int allOpenedDescendantsCount = 0;
+        unsigned int previousSiblingIndex;
 
-        if (parentNode.IsExpanded())
+        if (parentNode.IsExpanded() && index > 0 && IndexOfNode(parentNode.Children().GetAt(index - 1), previousSiblingIndex))
+        {
+            // Insert right after the previous sibling and its visible descendants.
+            unsigned int insertIndex = m_flatTree.SubtreeEnd(previousSiblingIndex);
+            AddNodeToView(targetNode, insertIndex);
+            if (targetNode.IsExpanded())
+            {
+                AddNodeDescendantsToView(targetNode, insertIndex, 0);
+            }
+        }
+        else if (parentNode.IsExpanded())
         {
             for (unsigned int i = 0; i < parentNode.Children().Size(); i++)
             {
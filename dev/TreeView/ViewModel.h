@@ -4,6 +4,7 @@
 #pragma once
 #include <Vector.h>
 #include "TreeViewNode.h"
+#include "FlatTreeIndex.h"
 
 using TreeNodeSelectionState = TreeViewNode::TreeNodeSelectionState;
 using ViewModelVectorOptions = typename VectorOptionsFromFlag<winrt::IInspectable, MakeVectorParam<VectorFlag::Observable, VectorFlag::DependencyObjectBase>()>;
@@ -81,6 +82,8 @@ private:
     winrt::weak_ref<winrt::TreeViewList> m_TreeViewList{ nullptr };
     tracker_ref<winrt::TreeViewNode> m_originNode{ this };
     bool m_isContentMode{ false };
+    // Mirrors the inner vector so that nodes can be located without scanning it.
+    FlatTreeIndex m_flatTree;
 
     // Methods
     winrt::TreeViewNode GetRemovedChildTreeViewNodeByIndex(winrt::TreeViewNode const& node, unsigned int childIndex);